@@ -0,0 +1,132 @@
+/**
+ * @file    alternative.h
+ * @brief   启动期指令热补丁框架接口
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件定义alternatives风格的启动期指令修补设施
+ *          - 编译时用ALTERNATIVE()宏把原始指令序列和按CPU特性
+ *            选择的候选指令序列分别放入.text与.altinstr_replacement，
+ *            并在.altinstructions记录一条修补描述
+ *          - 启动期cpu_probe之后，apply_alternatives()遍历描述表，
+ *            对当前CPU具备对应特性的记录原地覆盖原始指令，不足部分
+ *            以NOP补齐，之后热路径零分支地执行最优实现
+ *          - 候选指令必须与位置无关：长度以4字节指令为单位，且不得
+ *            含pc相对转移/取址指令（搬运后目标会错位）
+ *
+ * @note MISRA-C:2012 合规
+ * @warning 仅允许在启动期单核环境调用apply_alternatives()，
+ *          多核运行后修补正在执行的代码是不安全的
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _ALTERNATIVE_H
+#define _ALTERNATIVE_H
+
+/* ==================== 头文件包含 ==================== */
+#ifndef __ASSEMBLY__
+#include <system/types.h>
+#endif
+
+/* ==================== 宏定义 ==================== */
+
+/**
+ * @def ALT_NOP_INSN
+ * @brief LoongArch64 NOP指令编码（andi $zero, $zero, 0）
+ *
+ * @details 候选序列短于原始序列时用于补齐剩余指令槽
+ */
+#define ALT_NOP_INSN 0x03400000U
+
+#ifndef __ASSEMBLY__
+
+#define __ALT_STR1(x) #x
+#define __ALT_STR(x) __ALT_STR1(x)
+
+/**
+ * @def ALTERNATIVE
+ * @brief 按CPU特性二选一的指令序列
+ *
+ * @details 默认执行oldinstr；当cpu_data[0].options含feature对应
+ *          特性位时，启动期被newinstr原地覆盖。两段序列长度都必须
+ *          是4字节的整数倍，且newinstr不得长于oldinstr所在槽位之外
+ *          （短于时自动NOP补齐）
+ *
+ * @param oldinstr 原始（回退）指令序列字符串
+ * @param newinstr 特性可用时的替换指令序列字符串
+ * @param feature  CPU特性位编号（cpu-info.h中的CPU_FEATURE_x）
+ *
+ * @par 示例代码
+ * @code
+ * __asm__ volatile(
+ *     ALTERNATIVE("ll.w $t0, %1, 0\n\t"
+ *                 "add.w $t0, $t0, %2\n\t"
+ *                 "sc.w $t0, %1, 0",
+ *                 "amadd.w $zero, %2, %1",
+ *                 CPU_FEATURE_LAM)
+ *     : ...);
+ * @endcode
+ */
+#define ALTERNATIVE(oldinstr, newinstr, feature)                      \
+    "661:\n\t"                                                        \
+    oldinstr "\n"                                                     \
+    "662:\n\t"                                                        \
+    ".pushsection .altinstructions, \"a\"\n\t"                        \
+    ".align 2\n\t"                                                    \
+    ".long 661b - .\n\t"                      /* 原始指令相对偏移 */  \
+    ".long 663f - .\n\t"                      /* 候选指令相对偏移 */  \
+    ".short " __ALT_STR(feature) "\n\t"       /* 特性位编号 */        \
+    ".byte 662b - 661b\n\t"                   /* 原始序列长度 */      \
+    ".byte 664f - 663f\n\t"                   /* 候选序列长度 */      \
+    ".popsection\n\t"                                                 \
+    ".pushsection .altinstr_replacement, \"a\"\n"                     \
+    "663:\n\t"                                                        \
+    newinstr "\n"                                                     \
+    "664:\n\t"                                                        \
+    ".popsection\n\t"
+
+/* ==================== 数据结构 ==================== */
+
+/**
+ * @brief 指令修补描述记录
+ *
+ * @details 偏移为相对记录自身字段地址的有符号偏移，镜像整体
+ *          搬移后仍可定位，无需重定位
+ */
+struct alt_instr
+{
+    s32 instr_offset;   /**< @brief 原始指令相对本字段的偏移 */
+    s32 replace_offset; /**< @brief 候选指令相对本字段的偏移 */
+    u16 feature;        /**< @brief CPU特性位编号 */
+    u8 instrlen;        /**< @brief 原始序列长度（字节） */
+    u8 replacementlen;  /**< @brief 候选序列长度（字节） */
+} __attribute__((packed));
+
+/* ==================== 外部函数声明 ====================*/
+
+/**
+ * @brief 应用全部指令热补丁
+ *
+ * @details 遍历.altinstructions记录表，按cpu_data[0]特性位原地
+ *          覆盖命中的原始指令序列并NOP补齐，末尾统一完成一次
+ *          代码缓存同步
+ *
+ * @note 必须在cpu_probe()之后、从核释放之前由主核调用一次
+ */
+extern void apply_alternatives(void);
+
+#endif /* __ASSEMBLY__ */
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ALTERNATIVE_H */
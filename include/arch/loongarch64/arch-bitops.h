@@ -0,0 +1,257 @@
+/**
+ * @file    arch-bitops.h
+ * @brief   LoongArch64常数时间位操作库
+ * @author  Intewell Team
+ * @date    2025-08-29
+ * @version 1.0
+ *
+ * @details 本文件定义基于硬件位扫描指令的常数时间位操作
+ *          - clz.w/clz.d、ctz.w/ctz.d单指令包装（32/64位）
+ *          - ffs/fls/ffz派生接口，无循环无查表，任何输入都是
+ *            固定周期，适合调度器优先级位图与事件位图热路径
+ *          - 原子test_and_set/clear位操作，用amor_db.d/amand_db.d
+ *            单条AM指令完成读改写，无LL/SC重试环
+ *
+ * @note MISRA-C:2012 合规
+ * @note 位扫描指令对全零输入返回位宽（32/64），派生接口已处理
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _ARCH_BITOPS_H
+#define _ARCH_BITOPS_H
+
+/* ==================== 头文件包含 ==================== */
+#include <system/types.h>
+
+/* ==================== 宏定义 ==================== */
+
+/* 64位字内位号掩码与字索引移位 */
+#define BITOPS_WORD_MASK    63U
+#define BITOPS_WORD_SHIFT   6U
+
+/* ==================== 内联函数 ==================== */
+
+/**
+ * @brief 统计32位值的前导零数量
+ *
+ * @param x 待扫描的值
+ *
+ * @return 前导零数量（x为0时返回32）
+ */
+static inline u32 arch_clz32(u32 x)
+{
+    u32 n;
+
+    __asm__("clz.w %0, %1" : "=r"(n) : "r"(x));
+
+    return n;
+}
+
+/**
+ * @brief 统计64位值的前导零数量
+ *
+ * @param x 待扫描的值
+ *
+ * @return 前导零数量（x为0时返回64）
+ */
+static inline u32 arch_clz64(u64 x)
+{
+    u64 n;
+
+    __asm__("clz.d %0, %1" : "=r"(n) : "r"(x));
+
+    return (u32)n;
+}
+
+/**
+ * @brief 统计32位值的结尾零数量
+ *
+ * @param x 待扫描的值
+ *
+ * @return 结尾零数量（x为0时返回32）
+ */
+static inline u32 arch_ctz32(u32 x)
+{
+    u32 n;
+
+    __asm__("ctz.w %0, %1" : "=r"(n) : "r"(x));
+
+    return n;
+}
+
+/**
+ * @brief 统计64位值的结尾零数量
+ *
+ * @param x 待扫描的值
+ *
+ * @return 结尾零数量（x为0时返回64）
+ */
+static inline u32 arch_ctz64(u64 x)
+{
+    u64 n;
+
+    __asm__("ctz.d %0, %1" : "=r"(n) : "r"(x));
+
+    return (u32)n;
+}
+
+/**
+ * @brief 查找32位值的第一个置位位（1-based）
+ *
+ * @param x 待扫描的值
+ *
+ * @return 最低置位位的位置加1（x为0时返回0）
+ */
+static inline u32 arch_ffs32(u32 x)
+{
+    if (x == 0U)
+    {
+        return 0U;
+    }
+
+    return arch_ctz32(x) + 1U;
+}
+
+/**
+ * @brief 查找64位值的第一个置位位（1-based）
+ *
+ * @param x 待扫描的值
+ *
+ * @return 最低置位位的位置加1（x为0时返回0）
+ */
+static inline u32 arch_ffs64(u64 x)
+{
+    if (x == 0UL)
+    {
+        return 0U;
+    }
+
+    return arch_ctz64(x) + 1U;
+}
+
+/**
+ * @brief 查找32位值的最后一个置位位（1-based）
+ *
+ * @param x 待扫描的值
+ *
+ * @return 最高置位位的位置加1（x为0时返回0）
+ */
+static inline u32 arch_fls32(u32 x)
+{
+    return 32U - arch_clz32(x);
+}
+
+/**
+ * @brief 查找64位值的最后一个置位位（1-based）
+ *
+ * @param x 待扫描的值
+ *
+ * @return 最高置位位的位置加1（x为0时返回0）
+ */
+static inline u32 arch_fls64(u64 x)
+{
+    return 64U - arch_clz64(x);
+}
+
+/**
+ * @brief 查找64位值的第一个零位（0-based）
+ *
+ * @param x 待扫描的值
+ *
+ * @return 最低零位的位置（全1时返回64）
+ */
+static inline u32 arch_ffz64(u64 x)
+{
+    return arch_ctz64(~x);
+}
+
+/**
+ * @brief 原子置位
+ *
+ * @details 用amor_db.d单指令把目标位图中第nr位置1，
+ *          带屏障语义，无返回值
+ *
+ * @param nr 位号（可跨越多个64位字）
+ * @param addr 位图基地址（64位字数组）
+ */
+static inline void arch_set_bit(u32 nr, volatile unsigned long *addr)
+{
+    unsigned long mask = 1UL << (nr & BITOPS_WORD_MASK);
+    volatile unsigned long *word = &addr[nr >> BITOPS_WORD_SHIFT];
+
+    __asm__ __volatile__("amor_db.d $zero, %0, %1" :: "r"(mask), "r"(word) : "memory");
+}
+
+/**
+ * @brief 原子清位
+ *
+ * @details 用amand_db.d单指令把目标位图中第nr位清0，
+ *          带屏障语义，无返回值
+ *
+ * @param nr 位号（可跨越多个64位字）
+ * @param addr 位图基地址（64位字数组）
+ */
+static inline void arch_clear_bit(u32 nr, volatile unsigned long *addr)
+{
+    unsigned long mask = ~(1UL << (nr & BITOPS_WORD_MASK));
+    volatile unsigned long *word = &addr[nr >> BITOPS_WORD_SHIFT];
+
+    __asm__ __volatile__("amand_db.d $zero, %0, %1" :: "r"(mask), "r"(word) : "memory");
+}
+
+/**
+ * @brief 原子测试并置位
+ *
+ * @details 用amor_db.d单指令完成读改写并返回该位旧值，
+ *          无LL/SC重试环，高争用下延迟稳定
+ *
+ * @param nr 位号（可跨越多个64位字）
+ * @param addr 位图基地址（64位字数组）
+ *
+ * @return 该位的旧值（0或1）
+ */
+static inline int arch_test_and_set_bit(u32 nr, volatile unsigned long *addr)
+{
+    unsigned long mask = 1UL << (nr & BITOPS_WORD_MASK);
+    volatile unsigned long *word = &addr[nr >> BITOPS_WORD_SHIFT];
+    unsigned long old;
+
+    __asm__ __volatile__("amor_db.d %0, %1, %2" : "=&r"(old) : "r"(mask), "r"(word) : "memory");
+
+    return ((old & mask) != 0UL) ? 1 : 0;
+}
+
+/**
+ * @brief 原子测试并清位
+ *
+ * @details 用amand_db.d单指令完成读改写并返回该位旧值，
+ *          无LL/SC重试环，高争用下延迟稳定
+ *
+ * @param nr 位号（可跨越多个64位字）
+ * @param addr 位图基地址（64位字数组）
+ *
+ * @return 该位的旧值（0或1）
+ */
+static inline int arch_test_and_clear_bit(u32 nr, volatile unsigned long *addr)
+{
+    unsigned long mask = 1UL << (nr & BITOPS_WORD_MASK);
+    volatile unsigned long *word = &addr[nr >> BITOPS_WORD_SHIFT];
+    unsigned long old;
+
+    __asm__ __volatile__("amand_db.d %0, %1, %2" : "=&r"(old) : "r"(~mask), "r"(word) : "memory");
+
+    return ((old & mask) != 0UL) ? 1 : 0;
+}
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ARCH_BITOPS_H */
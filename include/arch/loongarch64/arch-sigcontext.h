@@ -179,6 +179,27 @@ struct lbt_context
 
 /** @} */
 
+/**
+ * @defgroup SkipContext 扩展状态占位节定义
+ * @{
+ */
+
+/**
+ * @brief 扩展状态占位节魔数（'SKIP'的ASCII）
+ *
+ * @details 信号投递时扩展状态不脏（自上次保存以来向量单元未被
+ *          写过）则只写本占位节，不落盘FPU/LSX/LASX状态；
+ *          sigreturn解析到本节时跳过扩展状态恢复
+ */
+#define SKIP_CTX_MAGIC 0x534B4950U
+
+/**
+ * @brief 扩展状态占位节对齐
+ */
+#define SKIP_CTX_ALIGN 16U
+
+/** @} */
+
 /* ==================== C++兼容性 ==================== */
 #ifdef __cplusplus
 extern "C"
@@ -21,9 +21,17 @@
 
 /* ==================== 头文件包含 ==================== */
 #include <asm-extable.h>
+#include <stdint.h>
 
 /* ==================== 宏定义 ==================== */
 
+/**
+ * @brief 用户空间指针标注（未定义时为空）
+ */
+#ifndef __user
+#define __user
+#endif
+
 /**
  * @brief 编译时断言宏（空实现）
  *
@@ -191,6 +199,47 @@ struct __large_struct
 /* ==================== 类型定义 ==================== */
 /* 本文件不定义类型 */
 
+/* ==================== 外部函数声明 ==================== */
+
+/**
+ * @brief 单遍从用户空间拷贝数据
+ *
+ * @details 基于异常修复表的单遍拷贝：不预先遍历页表，
+ *          访问出错由fixup_exception回填错误后返回剩余字节数
+ *
+ * @param to 目标地址（内核空间）
+ * @param from 源地址（用户空间）
+ * @param n 拷贝字节数
+ *
+ * @return 成功返回0，失败返回未拷贝的字节数
+ */
+extern unsigned long arch_copy_from_user(void *to, const void __user *from, unsigned long n);
+
+/**
+ * @brief 单遍向用户空间拷贝数据
+ *
+ * @details 基于异常修复表的单遍拷贝：不预先遍历页表，
+ *          访问出错由fixup_exception回填错误后返回剩余字节数
+ *
+ * @param to 目标地址（用户空间）
+ * @param from 源地址（内核空间）
+ * @param n 拷贝字节数
+ *
+ * @return 成功返回0，失败返回未拷贝的字节数
+ */
+extern unsigned long arch_copy_to_user(void __user *to, const void *from, unsigned long n);
+
+/**
+ * @brief 查询当前地址空间中一页的最终页表项
+ *
+ * @details 以当前PGDL为根遍历页表（经本核软件快表加速）
+ *
+ * @param vpage 页对齐的虚拟地址
+ *
+ * @return 最终页表项值，未映射返回0
+ */
+extern uint64_t uaccess_page_entry(uintptr_t vpage);
+
 /* ==================== C++兼容性 ==================== */
 #ifdef __cplusplus
 extern "C"
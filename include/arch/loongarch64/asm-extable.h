@@ -24,6 +24,28 @@
 
 /************************宏 定 义******************************/
 
+/**
+ * @defgroup ExtableTypes 异常表条目类型
+ * @{
+ */
+
+/**
+ * @brief 无修复动作
+ */
+#define EX_TYPE_NONE 0
+
+/**
+ * @brief 标准修复：仅跳转到fixup地址
+ */
+#define EX_TYPE_FIXUP 1
+
+/**
+ * @brief 用户访问修复：错误寄存器写入-EFAULT，目标寄存器清零后跳转
+ */
+#define EX_TYPE_UACCESS_ERR_ZERO 2
+
+/** @} */
+
 /**
  * @defgroup ExtableUtils 异常表工具宏
  * @{
@@ -111,8 +133,41 @@
 /** @} */
 
 /************************类型定义******************************/
+
+#ifndef __ASSEMBLY__
+
+/**
+ * @brief 异常表条目
+ *
+ * @details 与__ASM_EXTABLE_RAW发射的段内布局一一对应
+ *          insn/fixup为相对本字段地址的有符号偏移
+ */
+struct exception_table_entry
+{
+    int insn;   /**< @brief 可能出错指令的相对偏移 */
+    int fixup;  /**< @brief 修复跳转地址的相对偏移 */
+    short type; /**< @brief 修复类型（EX_TYPE_*） */
+    short data; /**< @brief 附加数据（寄存器编码等） */
+};
+
 /************************外部变量******************************/
 /************************外部函数******************************/
+
+/**
+ * @brief 异常表修复
+ *
+ * @details 在异常表中查找与csr_era匹配的条目并执行修复动作
+ *          仅内核态访问用户空间出错时可能命中
+ *
+ * @param regs 异常上下文
+ *
+ * @return 命中并修复返回true，未命中返回false
+ */
+struct arch_context;
+extern bool fixup_exception(struct arch_context *regs);
+
+#endif /* __ASSEMBLY__ */
+
 /************************内联函数******************************/
 /************************C++兼容性******************************/
 
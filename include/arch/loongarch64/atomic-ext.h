@@ -0,0 +1,206 @@
+/**
+ * @file    atomic-ext.h
+ * @brief   LoongArch64扩展原子操作接口（64位与松弛序变体）
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件声明atomic.S新增的原子操作入口
+ *          - 64位fetch_add/swap/and/or/xor族，全部为单条AM指令，
+ *            无LL/SC重试环，高争用下吞吐稳定
+ *          - _db后缀指令自带屏障语义（获取/释放），松弛序变体
+ *            （_relaxed）用于纯计数聚合等不要求顺序的场景
+ *          - 64位CAS为ll.d/sc.d实现（基础LA64无单指令CAS）
+ *          - 128位双字CAS为ll.d/sc.q实现（LoongArch v1.1），指针+
+ *            完整64位版本号的防ABA无锁结构不再需要把两者挤进64位
+ *
+ * @note MISRA-C:2012 合规
+ * @note LoongArch64 ISA基线包含LAM原子指令扩展，无需运行时探测
+ * @note 128位原语依赖sc.q指令，使用前必须确认cpu_has_scq为真
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _ATOMIC_EXT_H
+#define _ATOMIC_EXT_H
+
+/* ==================== 头文件包含 ==================== */
+#include <system/types.h>
+
+/* ==================== 类型定义 ==================== */
+
+/**
+ * @brief 128位原子操作数（双字对）
+ *
+ * @details lo/hi按内存序排列（lo在低地址），对象必须16字节对齐，
+ *          否则ll.d/sc.q触发对齐异常；典型用法是lo放指针、
+ *          hi放完整64位版本号以防ABA
+ */
+typedef struct atomic128
+{
+    u64 lo; /**< @brief 低64位（低地址） */
+    u64 hi; /**< @brief 高64位（高地址） */
+} __attribute__((aligned(16))) atomic128_t;
+
+/* ==================== 外部函数声明 ==================== */
+
+/**
+ * @brief 32位原子加法（松弛序，返回旧值）
+ */
+extern int atomic32_add_relaxed(volatile int *target, int value);
+
+/**
+ * @brief 32位原子设置（松弛序，返回旧值）
+ */
+extern int atomic32_set_relaxed(volatile int *target, int value);
+
+/**
+ * @brief 64位原子加法（返回旧值）
+ */
+extern s64 atomic64_add(volatile s64 *target, s64 value);
+
+/**
+ * @brief 64位原子加法（返回新值）
+ */
+extern s64 atomic64_add_return(volatile s64 *target, s64 value);
+
+/**
+ * @brief 64位原子加法（松弛序，返回旧值）
+ */
+extern s64 atomic64_add_relaxed(volatile s64 *target, s64 value);
+
+/**
+ * @brief 64位原子减法（返回旧值）
+ */
+extern s64 atomic64_sub(volatile s64 *target, s64 value);
+
+/**
+ * @brief 64位原子减法（返回新值）
+ */
+extern s64 atomic64_sub_return(volatile s64 *target, s64 value);
+
+/**
+ * @brief 64位原子自增（返回新值）
+ */
+extern s64 atomic64_inc_return(volatile s64 *target);
+
+/**
+ * @brief 64位原子自减（返回新值）
+ */
+extern s64 atomic64_dec_return(volatile s64 *target);
+
+/**
+ * @brief 64位原子按位或（返回旧值）
+ */
+extern s64 atomic64Or(volatile s64 *target, s64 value);
+
+/**
+ * @brief 64位原子按位与（返回旧值）
+ */
+extern s64 atomic64And(volatile s64 *target, s64 value);
+
+/**
+ * @brief 64位原子按位异或（返回旧值）
+ */
+extern s64 atomic64Xor(volatile s64 *target, s64 value);
+
+/**
+ * @brief 64位原子设置（返回旧值）
+ */
+extern s64 atomic64_set(volatile s64 *target, s64 value);
+
+/**
+ * @brief 64位原子设置（松弛序，返回旧值）
+ */
+extern s64 atomic64_set_relaxed(volatile s64 *target, s64 value);
+
+/**
+ * @brief 64位原子读取
+ */
+extern s64 atomic64Get(volatile s64 *target);
+
+/**
+ * @brief 64位原子清除（返回旧值）
+ */
+extern s64 atomic64Clear(volatile s64 *target);
+
+/**
+ * @brief 64位原子比较交换
+ *
+ * @return 相等并交换成功返回1，不相等返回0
+ */
+extern int atomic64_cas(volatile s64 *target, s64 old_value, s64 new_value);
+
+/**
+ * @brief 128位原子比较交换（双字CAS）
+ *
+ * @details target指向的128位值与old_lo/old_hi整体比较，
+ *          两个双字都相等时替换为new_lo/new_hi
+ *
+ * @param target 目标地址（必须16字节对齐）
+ * @param old_lo 期望值低64位
+ * @param old_hi 期望值高64位
+ * @param new_lo 新值低64位
+ * @param new_hi 新值高64位
+ *
+ * @return 相等并交换成功返回1，不相等返回0
+ *
+ * @note 需要sc.q支持（调用前确认cpu_has_scq）
+ */
+extern int atomic128_cas(volatile atomic128_t *target, u64 old_lo, u64 old_hi, u64 new_lo, u64 new_hi);
+
+/**
+ * @brief 128位原子读取
+ *
+ * @details 一致性读取target指向的128位值，
+ *          保证lo/hi来自同一时刻的快照
+ *
+ * @param target 目标地址（必须16字节对齐）
+ * @param out_lo 低64位输出地址
+ * @param out_hi 高64位输出地址
+ *
+ * @return 无
+ *
+ * @note 需要sc.q支持（调用前确认cpu_has_scq）
+ */
+extern void atomic128Get(volatile atomic128_t *target, u64 *out_lo, u64 *out_hi);
+
+/* ==================== 内联函数 ==================== */
+
+/**
+ * @brief 128位原子比较交换（结构体封装）
+ *
+ * @details atomic128_cas的双字对封装，成功时交换并返回1；
+ *          失败时把当前值一致性读回old供调用方重试
+ *
+ * @param target 目标地址（必须16字节对齐）
+ * @param old 期望值，失败时被更新为当前值
+ * @param value 新值
+ *
+ * @return 交换成功返回1，失败返回0
+ *
+ * @note 需要sc.q支持（调用前确认cpu_has_scq）
+ */
+static inline int atomic128_cas_pair(volatile atomic128_t *target, atomic128_t *old, const atomic128_t *value)
+{
+    int ret = atomic128_cas(target, old->lo, old->hi, value->lo, value->hi);
+
+    if (ret == 0)
+    {
+        atomic128Get(target, &old->lo, &old->hi);
+    }
+
+    return ret;
+}
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _ATOMIC_EXT_H */
@@ -28,6 +28,20 @@
 /************************外部变量******************************/
 /************************外部函数******************************/
 
+/**
+ * @brief 构建符号地址二分索引
+ *
+ * @details 将全局符号表按地址排序建立索引，使回溯时的符号查询
+ *          从线性扫描降为二分查找；并配合text段边界缓存，
+ *          支撑高频（如100Hz采样）调用栈采集
+ *
+ * @note 应在启动阶段（单核）调用一次；未调用时首次回溯会惰性构建
+ * @note 重复调用为幂等空操作
+ *
+ * @see backtrace()
+ */
+void backtrace_symtab_init(void);
+
 /**
  * @brief 显示栈回溯信息
  *
@@ -83,6 +97,37 @@ void backtrace(const char *cookie);
  */
 void backtrace_r(const char *cookie, uintptr_t frame_address);
 
+/**
+ * @brief 捕获当前调用栈到定长缓冲区
+ *
+ * @details 从当前帧开始提取各层调用点地址，不做符号解析、不打印，
+ *          适合在中断上下文中快速执行（跨核backtrace快照采集）
+ *
+ * @param buf 输出缓冲区，逐层存放调用点地址
+ * @param max 缓冲区容量（地址个数）
+ *
+ * @return 实际捕获的层数
+ *
+ * @note 性能关键路径：调用方保证buf有效
+ *
+ * @see backtrace_snapshot_print()
+ */
+unsigned int backtrace_capture(uintptr_t *buf, unsigned int max);
+
+/**
+ * @brief 符号化打印一组调用点地址
+ *
+ * @details 对backtrace_capture采集的地址快照逐层符号化输出，
+ *          格式与backtrace()一致
+ *
+ * @param cpu   快照来源CPU编号（仅用于输出标识）
+ * @param addrs 调用点地址数组
+ * @param count 地址个数
+ *
+ * @see backtrace_capture()
+ */
+void backtrace_snapshot_print(unsigned int cpu, const uintptr_t *addrs, unsigned int count);
+
 /************************内联函数******************************/
 /************************C++兼容性******************************/
 
@@ -0,0 +1,76 @@
+/**
+ * @file    boot-trace.h
+ * @brief   启动阶段耗时追踪接口
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件定义轻量启动耗时追踪设施
+ *          - 各初始化阶段以rdtime.d打点写入静态数组，单次打点
+ *            开销为一次计数器读取与两次存储
+ *          - crt1.S在_start入口与跳转C入口前各打一次汇编阶段
+ *            时间戳，经boot_trace_asm_import归入报表
+ *          - 启动完成后boot_trace_report按阶段输出耗时报表，
+ *            用于量化故障恢复重启SLA
+ *
+ * @note MISRA-C:2012 合规
+ * @note 仅限启动阶段单核顺序调用，不加锁
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _BOOT_TRACE_H
+#define _BOOT_TRACE_H
+
+/* ==================== 头文件包含 ==================== */
+#include <system/types.h>
+
+/* ==================== 外部函数声明 ==================== */
+
+/**
+ * @brief 记录一个启动阶段打点
+ *
+ * @details 以当前rdtime.d计数记录阶段完成点；相邻打点的
+ *          计数差即上一阶段耗时
+ *
+ * @param name 阶段名称（须为静态字符串，只保存指针）
+ */
+extern void boot_trace_mark(const char *name);
+
+/**
+ * @brief 以指定时间戳记录一个启动阶段打点
+ *
+ * @details 用于汇编阶段等事后补录的时间戳
+ *
+ * @param name 阶段名称（须为静态字符串，只保存指针）
+ * @param tsc  rdtime.d时间戳
+ */
+extern void boot_trace_mark_tsc(const char *name, u64 tsc);
+
+/**
+ * @brief 导入crt1.S记录的汇编阶段时间戳
+ *
+ * @details 将_start入口与C环境就绪两处汇编打点归入报表；
+ *          须在进入C环境后、其他打点之前调用一次
+ */
+extern void boot_trace_asm_import(void);
+
+/**
+ * @brief 输出分阶段启动耗时报表
+ *
+ * @details 按打点顺序经klog输出各阶段耗时（周期与微秒）；
+ *          须在时钟源初始化完成、计数器频率可得后调用
+ */
+extern void boot_trace_report(void);
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _BOOT_TRACE_H */
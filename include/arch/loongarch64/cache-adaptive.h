@@ -0,0 +1,84 @@
+/**
+ * @file    cache-adaptive.h
+ * @brief   规模自适应缓存维护接口
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件定义按范围大小自适应的数据缓存维护入口
+ *          - 启动时经CPUCFG16~20探测各级缓存的行大小与容量，
+ *            行大小不再硬编码64字节
+ *          - 范围不小于末级缓存容量时按行维护已无收益，自动
+ *            切换为全量操作；小范围走按行cacop命中操作
+ *          - 面向非一致性DMA缓冲（256B~16MB量级）场景
+ *
+ * @note MISRA-C:2012 合规
+ * @note 未探测时按64字节行、全量路径保守回退
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _CACHE_ADAPTIVE_H
+#define _CACHE_ADAPTIVE_H
+
+/* ==================== 头文件包含 ==================== */
+#include <stddef.h>
+#include <system/types.h>
+
+/* ==================== 外部函数声明 ==================== */
+
+/**
+ * @brief 探测缓存几何参数
+ *
+ * @details 读CPUCFG16~20，记录L1D行大小与各级数据缓存容量，
+ *          计算按行/全量切换阈值；启动阶段调用一次
+ */
+extern void cache_geometry_init(void);
+
+/**
+ * @brief 获取探测到的数据缓存行大小
+ *
+ * @return 行大小（字节），未探测时返回64
+ */
+extern u32 cache_line_size_get(void);
+
+/**
+ * @brief 获取探测到的末级缓存容量
+ *
+ * @return 末级缓存容量（字节），未探测时返回0
+ */
+extern size_t cache_llc_size_get(void);
+
+/**
+ * @brief 自适应写回并无效指定范围的数据缓存
+ *
+ * @details 范围小于阈值时按探测行大小逐行cacop命中写回无效，
+ *          否则执行全量操作
+ *
+ * @param vaddr_start 起始虚拟地址
+ * @param len         长度（字节）
+ */
+extern void cache_dcache_flush_adaptive(size_t vaddr_start, size_t len);
+
+/**
+ * @brief 自适应使指定范围的数据缓存无效
+ *
+ * @details LoongArch的cacop命中类操作为写回并无效，无效语义
+ *          复用同一按行路径；范围超过阈值走全量操作
+ *
+ * @param vaddr_start 起始虚拟地址
+ * @param len         长度（字节）
+ */
+extern void cache_dcache_invd_adaptive(size_t vaddr_start, size_t len);
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CACHE_ADAPTIVE_H */
@@ -0,0 +1,90 @@
+/**
+ * @file    cache-text.h
+ * @brief   代码修补批量缓存同步接口
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件定义批量代码修补缓存同步接口
+ *          - 动态加载器一次加载需修补数千个重定位点，逐点调用
+ *            cache_text_update会重复执行指令屏障
+ *          - 批量接口先收集(addr, len)修补区间并就地合并相邻
+ *            区间，提交时逐区间完成数据缓存同步，指令屏障只在
+ *            末尾执行一次
+ *          - 批量上下文由调用方持有，无全局状态，无需加锁
+ *
+ * @note MISRA-C:2012 合规
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _CACHE_TEXT_H
+#define _CACHE_TEXT_H
+
+/* ==================== 头文件包含 ==================== */
+#include <stddef.h>
+#include <system/types.h>
+
+/* ==================== 宏定义 ==================== */
+
+/**
+ * @brief 批量上下文可容纳的合并后区间数
+ *
+ * @details 区间写满时自动提交一次并继续收集，接口不失败
+ */
+#define CACHE_TEXT_BATCH_SLOTS 64U
+
+/* ==================== 数据结构 ==================== */
+
+/**
+ * @brief 批量修补区间收集上下文
+ */
+struct cache_text_batch
+{
+    size_t addr[CACHE_TEXT_BATCH_SLOTS]; /**< @brief 区间起始地址 */
+    size_t len[CACHE_TEXT_BATCH_SLOTS];  /**< @brief 区间长度（字节） */
+    u32 count;                           /**< @brief 已收集区间数 */
+};
+
+/* ==================== 外部函数声明 ==================== */
+
+/**
+ * @brief 初始化批量修补上下文
+ *
+ * @param batch 批量上下文（不能为NULL）
+ */
+extern void cache_text_batch_init(struct cache_text_batch *batch);
+
+/**
+ * @brief 收集一个修补区间
+ *
+ * @details 与已收集区间重叠或相邻时就地合并；区间表满时
+ *          自动提交当前批次后继续收集
+ *
+ * @param batch       批量上下文（不能为NULL）
+ * @param vaddr_start 修补起始虚拟地址
+ * @param len         修补长度（字节）
+ */
+extern void cache_text_batch_add(struct cache_text_batch *batch, size_t vaddr_start, size_t len);
+
+/**
+ * @brief 提交批量修补的缓存同步
+ *
+ * @details 逐区间完成数据缓存同步后执行一次指令屏障，
+ *          并清空上下文以便复用
+ *
+ * @param batch 批量上下文（不能为NULL）
+ */
+extern void cache_text_batch_flush(struct cache_text_batch *batch);
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CACHE_TEXT_H */
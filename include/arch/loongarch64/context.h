@@ -94,15 +94,16 @@ struct loongarch_fpu
  */
 struct arch_context
 {
+    /*
+     * 布局契约：regs到csr_estat的前缀与ptrace导出的
+     * user_regs_struct逐字段一致，regset传输可从异常帧
+     * 单次整体拷贝；汇编侧经asm-offsets生成的偏移自动
+     * 跟随，调整成员顺序前先确认两侧断言
+     */
+
     /* 主处理器寄存器 */
     u64 regs[32]; /**< 通用寄存器r0-r31 */
 
-    /* 系统调用原始参数 */
-    u64 orig_a0; /**< 系统调用原始参数a0 */
-
-    /* 上下文类型 */
-    u64 type; /**< 上下文类型（IRQ/SYSCALL等） */
-
     /* CSR特殊寄存器 */
     u64 csr_era; /**< 异常返回地址 */
     u64 csr_badvaddr; /**< 出错虚拟地址 */
@@ -112,6 +113,12 @@ struct arch_context
     u64 csr_ecfg; /**< 异常配置 */
     u64 csr_estat; /**< 异常状态 */
 
+    /* 系统调用原始参数 */
+    u64 orig_a0; /**< 系统调用原始参数a0 */
+
+    /* 上下文类型 */
+    u64 type; /**< 上下文类型（IRQ/SYSCALL等） */
+
     /* 可变长度数组（用于扩展） */
     u64 __last[]; /**< 扩展字段 */
 } __attribute__((__aligned__(8)));
@@ -0,0 +1,86 @@
+/**
+ * @file    coredump-stream.h
+ * @brief   流式核心转储写出接口
+ * @author  Intewell Team
+ * @date    2025-08-29
+ * @version 1.0
+ *
+ * @details 本文件定义流式coredump写出管道的回调接口
+ *          - 按页扫描，只转储已映射页
+ *          - 全零页与未映射页合并写为稀疏洞
+ *          - 边读边写不做整体缓冲，转储耗时与进程体积解耦
+ *
+ * @note MISRA-C:2012 合规
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _COREDUMP_STREAM_H
+#define _COREDUMP_STREAM_H
+
+/* ==================== 头文件包含 ==================== */
+#include <stddef.h>
+#include <stdint.h>
+#include <system/types.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/* ==================== 类型定义 ==================== */
+
+/**
+ * @brief 转储数据写出回调
+ *
+ * @details 由上层转储器提供，把一段页数据写入输出端
+ *          （文件、管道或网络），可内部分块，返回前须消费全部数据
+ *
+ * @param priv 上层私有上下文
+ * @param buf  数据起始地址（页对齐，直接指向用户页）
+ * @param len  数据长度（字节，页大小的整数倍）
+ *
+ * @return 成功返回0，失败返回负错误码（终止转储）
+ */
+typedef s32 (*coredump_emit_fn)(void *priv, const void *buf, size_t len);
+
+/**
+ * @brief 稀疏洞跳过回调
+ *
+ * @details 输出端把len字节记为洞（文件lseek或写出零填充头），
+ *          未映射页与全零页经合并后以此回调写出
+ *
+ * @param priv 上层私有上下文
+ * @param len  洞长度（字节，页大小的整数倍）
+ *
+ * @return 成功返回0，失败返回负错误码（终止转储）
+ */
+typedef s32 (*coredump_skip_fn)(void *priv, size_t len);
+
+/* ==================== 外部函数声明 ==================== */
+
+/**
+ * @brief 流式转储一段用户虚拟地址范围
+ *
+ * @details 逐页查页表，只读取已映射页；全零页检测后与未映射页
+ *          一并合并为稀疏洞，经skip回调写出；非零页直接从用户
+ *          映射经emit回调写出，全程不做整体缓冲
+ *
+ * @param start 起始虚拟地址（页对齐）
+ * @param end   结束虚拟地址（页对齐，不含）
+ * @param emit  数据写出回调（不能为NULL）
+ * @param skip  稀疏洞跳过回调（不能为NULL）
+ * @param priv  回调私有上下文
+ *
+ * @return 成功返回0，参数非法返回-EINVAL，回调失败时透传其错误码
+ *
+ * @note 须在目标进程的地址空间上下文中调用
+ */
+extern s32 elf_dump_memory(uintptr_t start, uintptr_t end, coredump_emit_fn emit, coredump_skip_fn skip, void *priv);
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _COREDUMP_STREAM_H */
@@ -133,6 +133,7 @@
 #define cpu_has_ptw cpu_opt(LOONGARCH_CPU_PTW)                             /**< 硬件页表遍历器 */
 #define cpu_has_lspw cpu_opt(LOONGARCH_CPU_LSPW)                           /**< LSPW (lddir/ldpte指令) */
 #define cpu_has_avecint cpu_opt(LOONGARCH_CPU_AVECINT)                     /**< AVEC中断 */
+#define cpu_has_scq cpu_opt(LOONGARCH_CPU_SCQ)                             /**< sc.q（128位条件存储） */
 
 /** @} */
 
@@ -289,6 +289,7 @@ extern const char *__cpu_full_name[];
 #define CPU_FEATURE_PTW 27        /**< 硬件页表遍历器支持 */
 #define CPU_FEATURE_LSPW 28       /**< LSPW（lddir/ldpte指令）支持 */
 #define CPU_FEATURE_AVECINT 29    /**< AVEC中断支持 */
+#define CPU_FEATURE_SCQ 30        /**< sc.q（128位条件存储）支持 */
 
 /**
  * @brief CPU特性位定义
@@ -325,6 +326,7 @@ extern const char *__cpu_full_name[];
 #define LOONGARCH_CPU_PTW BIT_ULL(CPU_FEATURE_PTW)
 #define LOONGARCH_CPU_LSPW BIT_ULL(CPU_FEATURE_LSPW)
 #define LOONGARCH_CPU_AVECINT BIT_ULL(CPU_FEATURE_AVECINT)
+#define LOONGARCH_CPU_SCQ BIT_ULL(CPU_FEATURE_SCQ)
 
 /** @} */
 
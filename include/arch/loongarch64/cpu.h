@@ -255,6 +255,7 @@ extern "C"
 #define CPUCFG2_LSPW BIT(21)           /**< LSPW指令支持 */
 #define CPUCFG2_LAM BIT(22)            /**< 原子指令支持 */
 #define CPUCFG2_PTW BIT(24)            /**< 页表遍历器支持 */
+#define CPUCFG2_SCQ BIT(30)            /**< sc.q（128位条件存储）支持 */
 /** @} */
 
 /**
@@ -421,6 +422,15 @@ extern "C"
 #define CSR_PRMD_PPLV_SHIFT 0        /**< 前一特权级位移 */
 #define CSR_PRMD_PPLV_WIDTH 2        /**< 前一特权级宽度 */
 #define CSR_PRMD_PPLV (_ULCAST_(0x3) << CSR_PRMD_PPLV_SHIFT) /**< 前一特权级 */
+
+/**
+ * @brief 进程首次进入用户态时的PRMD初值
+ *
+ * @details PPLV=3（用户模式）、PIE=1（中断使能）、PWE=1（监视点使能），
+ *          编译期常量，进入路径无需逐次计算
+ */
+#define CSR_PRMD_USER_INIT \
+    (CSR_PRMD_PWE | CSR_PRMD_PIE | (_ULCAST_(PLV_USER) << CSR_PRMD_PPLV_SHIFT))
 /** @} */
 
 /**
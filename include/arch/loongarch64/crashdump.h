@@ -0,0 +1,133 @@
+/**
+ * @file    crashdump.h
+ * @brief   崩溃上下文快速持久化接口
+ * @author  Intewell Team
+ * @date    2025-08-29
+ * @version 1.0
+ *
+ * @details 本文件定义崩溃快存接口
+ *          - 致命异常路径把异常上下文、回溯地址快照和klog环
+ *            缓冲二进制写入一块跨重启保留的RAM区域，毫秒级
+ *            完成后即可交由看门狗复位，诊断信息重启后离线解析
+ *          - 保留区经DMW不可缓存窗口访问，写入不经过数据缓存，
+ *            复位前无需额外的缓存清理
+ *          - 记录头的magic最后写入并带校验和，半截记录在下次
+ *            启动校验时被丢弃
+ *
+ * @note MISRA-C:2012 合规
+ * @warning 保留区物理范围必须在平台内存配置中预留，
+ *          不得划入普通内存池
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _CRASHDUMP_H
+#define _CRASHDUMP_H
+
+/* ==================== 头文件包含 ==================== */
+#include <arch/loongarch64/context.h>
+#include <system/types.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/* ==================== 宏定义 ==================== */
+
+/**
+ * @brief 保留区物理基地址
+ *
+ * @details 默认取低256MB窗口末尾1MB处，平台可经Kconfig覆盖；
+ *          该范围必须从普通内存池中扣除
+ */
+#ifndef CONFIG_CRASHDUMP_PHYS_BASE
+#define CONFIG_CRASHDUMP_PHYS_BASE 0x0FF00000UL
+#endif
+
+/**
+ * @brief 保留区大小（字节）
+ *
+ * @details 需容纳记录头、异常上下文、回溯快照和全部CPU的
+ *          klog环缓冲
+ */
+#ifndef CONFIG_CRASHDUMP_SIZE
+#define CONFIG_CRASHDUMP_SIZE 0x00020000UL
+#endif
+
+/**
+ * @brief 记录头magic（"CRSH"）
+ */
+#define CRASHDUMP_MAGIC 0x43525348UL
+
+/**
+ * @brief 记录格式版本号
+ */
+#define CRASHDUMP_VERSION 1U
+
+/**
+ * @brief 回溯地址快照的最大层数
+ */
+#define CRASHDUMP_BT_MAX 32U
+
+/* ==================== 数据结构 ==================== */
+
+/**
+ * @brief 崩溃记录头
+ *
+ * @details 位于保留区起始处，payload紧随其后依次为：
+ *          异常上下文（struct arch_context）、回溯地址数组
+ *          （CRASHDUMP_BT_MAX个uintptr_t）、klog环缓冲原始字节
+ *
+ * @note magic最后写入：校验时magic、version与checksum三者
+ *       同时匹配才认为记录完整
+ */
+struct crashdump_header
+{
+    u64 magic;       /**< @brief 记录magic（CRASHDUMP_MAGIC） */
+    u32 version;     /**< @brief 记录格式版本 */
+    u32 cpu;         /**< @brief 崩溃CPU编号 */
+    u64 tsc;         /**< @brief 崩溃时间戳（rdtime计数） */
+    u32 bt_count;    /**< @brief 回溯地址有效层数 */
+    u32 klog_len;    /**< @brief klog快照字节数 */
+    u32 payload_len; /**< @brief payload总字节数 */
+    u32 checksum;    /**< @brief payload的32位累加校验和 */
+};
+
+/* ==================== 外部函数声明 ==================== */
+
+/**
+ * @brief 崩溃快存初始化
+ *
+ * @details 建立保留区的不可缓存访问基址；若检测到上次运行
+ *          留下的完整崩溃记录则记录一条日志提示离线提取，
+ *          记录本身保留，由下一次崩溃写入时覆盖
+ *
+ * @return 无
+ *
+ * @note 应在启动阶段（单核）调用一次
+ */
+extern void crashdump_init(void);
+
+/**
+ * @brief 持久化崩溃现场
+ *
+ * @details 把异常上下文、回溯地址快照和klog环缓冲二进制写入
+ *          保留区，全程仅内存拷贝，毫秒级完成；仅第一个进入
+ *          的CPU执行写入，后续CPU直接返回
+ *
+ * @param context 异常上下文指针（不能为NULL）
+ *
+ * @return 无
+ *
+ * @note 仅限不可恢复错误路径调用（关中断上下文安全）
+ * @note 写入完成后调用方可立即触发复位，无需等待串口输出
+ */
+extern void crashdump_save(const arch_exception_context_t *context);
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CRASHDUMP_H */
@@ -0,0 +1,125 @@
+/**
+ * @file    current.h
+ * @brief   per-CPU当前任务指针快速访问接口
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件基于$r21（u0）per-CPU基址寄存器提供快速访问
+ *          - 当前任务指针一条load可得，替代调度热路径上
+ *            "读CSR取核号→查表"的两步查找（cpuid_get读
+ *            LOONGARCH_CSR_CPUID约数十周期）
+ *          - 核号同样缓存在per-CPU区，一条load可得
+ *          - $r21由crt1.S在各核启动时装入__per_cpu_offset，
+ *            随核不随任务，任务切换与异常路径均不改写
+ *
+ * @note MISRA-C:2012 合规
+ * @note 性能关键路径：访问器全部内联，无函数调用开销
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _CURRENT_H
+#define _CURRENT_H
+
+/* ==================== 头文件包含 ==================== */
+#include <cpu.h>
+#include <percpu.h>
+#include <system/types.h>
+
+/* ==================== 外部变量 ==================== */
+DECLARE_PER_CPU(void *, arch_current_task);
+DECLARE_PER_CPU(u32, arch_cpu_id);
+
+/* ==================== 宏定义 ==================== */
+
+/**
+ * @brief 取本核per-CPU变量地址
+ *
+ * @details 变量地址加$r21偏移直接寻址，无CSR读取、无查表；
+ *          替代"cpuid_get()取核号→per_cpu(var, cpu)索引数组"
+ *          的两步模式
+ *
+ * @param var per-CPU变量名（DEFINE_PER_CPU定义）
+ *
+ * @note 性能关键路径：调用方须保证不被迁移到其他核
+ */
+#define this_cpu_ptr(var) ((__typeof__(&(var)))((unsigned long)&(var) + __my_cpu_offset))
+
+/**
+ * @brief 读本核per-CPU变量（一条load）
+ */
+#define this_cpu_read(var) (*this_cpu_ptr(var))
+
+/**
+ * @brief 写本核per-CPU变量（一条store）
+ */
+#define this_cpu_write(var, val) (*this_cpu_ptr(var) = (val))
+
+/* ==================== 内联函数 ==================== */
+
+/**
+ * @brief 获取本核当前任务指针
+ *
+ * @details per-CPU变量地址加$r21偏移直接寻址，一条load完成
+ *
+ * @return 当前任务指针；本核尚未设置时为NULL
+ *
+ * @note 性能关键路径：调用方须保证不被迁移到其他核
+ *       （关抢占或中断上下文）
+ */
+static inline void *arch_current_get(void)
+{
+    return this_cpu_read(arch_current_task);
+}
+
+/**
+ * @brief 设置本核当前任务指针
+ *
+ * @details 由调度器在任务切换时调用，随上下文切换一并更新
+ *
+ * @param task 即将投入运行的任务指针
+ *
+ * @note 性能关键路径：一条store，调用方保证关抢占
+ */
+static inline void arch_current_set(void *task)
+{
+    this_cpu_write(arch_current_task, task);
+}
+
+/**
+ * @brief 获取本核核号（快速路径）
+ *
+ * @details 读per-CPU缓存值，替代cpuid_get的CSR读取
+ *
+ * @return 本核CPU编号
+ *
+ * @note 须在arch_current_init之后使用
+ */
+static inline u32 cpuid_get_fast(void)
+{
+    return *(volatile u32 *)this_cpu_ptr(arch_cpu_id);
+}
+
+/* ==================== 外部函数声明 ==================== */
+
+/**
+ * @brief 初始化本核per-CPU快速访问数据
+ *
+ * @details 各核启动阶段调用一次：缓存CSR核号，清空当前任务指针
+ *
+ * @note 须在$r21（per-CPU基址）建立之后调用
+ */
+extern void arch_current_init(void);
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _CURRENT_H */
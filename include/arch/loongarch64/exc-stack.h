@@ -0,0 +1,70 @@
+/**
+ * @file    exc-stack.h
+ * @brief   每核专用异常/中断栈
+ * @author  Intewell Team
+ * @date    2025-08-29
+ * @version 1.0
+ *
+ * @details 本文件定义每核专用异常/中断栈的布局与接口
+ *          - 栈体4KB对齐，启动时逐页预触碰，消除首次进
+ *            中断触页的TLB/缓存缺失
+ *          - 栈顶常驻KSave寄存器（EXCEPTION_KS2），中断入口
+ *            一条csrrd即取得栈顶完成切换
+ *          - 嵌套中断经地址区间判定留在异常栈原地压栈，
+ *            嵌套深度受栈体大小约束，不再侵占任务栈
+ *
+ * @note MISRA-C:2012 合规
+ * @note 本头文件同时供汇编（ASM_USE）与C代码包含
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _EXC_STACK_H
+#define _EXC_STACK_H
+
+/* ==================== 宏定义 ==================== */
+
+/**
+ * @brief 每核异常栈大小（字节，4KB的整数倍）
+ */
+#define EXC_STACK_SIZE 0x4000
+
+/**
+ * @brief 异常栈对齐（4KB，栈顶天然缓存行对齐）
+ */
+#define EXC_STACK_ALIGN 0x1000
+
+#ifndef LOONGARCH_CSR_KS2
+#define LOONGARCH_CSR_KS2 0x32 /**< @brief KSave2暂存寄存器 */
+#endif
+
+#ifndef EXCEPTION_KS2
+#define EXCEPTION_KS2 LOONGARCH_CSR_KS2 /**< @brief 常驻本核异常栈顶 */
+#endif
+
+#ifndef ASM_USE
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/* ==================== 外部函数声明 ==================== */
+
+/**
+ * @brief 初始化本核异常栈
+ *
+ * @details 逐页预触碰栈体并把栈顶写入EXCEPTION_KS2；
+ *          写入前中断入口的栈切换判空跳过，行为与原路径一致
+ *
+ * @note 每个核在本核初始化阶段各调用一次
+ */
+extern void exc_stack_init(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !ASM_USE */
+
+#endif /* _EXC_STACK_H */
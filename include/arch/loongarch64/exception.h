@@ -78,6 +78,35 @@ extern "C"
     /************************异常向量表******************************/
     extern void *exception_table[];
 
+    /**
+     * @brief 注册中断线直达处理函数
+     *
+     * @details 注册后该中断线经向量化入口直接调用处理函数，
+     *          跳过公共分发层的pic_ack扫描链；直达处理函数须
+     *          自行完成本线路的设备级应答/清中断
+     *
+     * @param line    CPU中断线号（INT_SWI0 ~ INT_AVEC）
+     * @param handler 直达处理函数（不能为NULL）
+     * @param arg     处理函数私有参数
+     *
+     * @return 成功返回0，参数非法返回-EINVAL
+     */
+    extern s32 vint_direct_install(u32 line, void (*handler)(uint32_t irq, void *arg), void *arg);
+
+    /**
+     * @brief 配置低延迟中断优先组
+     *
+     * @details 组内任一线路触发陷入时，分发侧读取一次ESTAT并
+     *          以clz位扫描批量收割组内其余挂起线路（线号越大
+     *          优先级越高），多个同组中断共享一次上下文保存与
+     *          恢复往返；组内未注册直达处理的线路被跳过
+     *
+     * @param mask 优先组掩码（按ESTAT.IS位布局）
+     *
+     * @return 成功返回0，掩码超出ESTAT.IS范围返回-EINVAL
+     */
+    extern s32 vint_priority_group_set(u32 mask);
+
     /************************异常码定义******************************/
 
     /**
@@ -0,0 +1,71 @@
+/**
+ * @file    fpu-lazy.h
+ * @brief   LoongArch64惰性FPU/LSX/LASX上下文切换接口
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件定义惰性浮点/向量上下文切换对外接口
+ *          - 切出时仅在任务真正使用过浮点/向量单元时保存状态
+ *          - 切入时关断EUEN使能位，首次使用经FPDIS/LSXDIS/LASXDIS陷入换入
+ *          - 维护per-CPU"最后拥有者"记录，同核往返免重复恢复
+ *
+ * @note MISRA-C:2012 合规
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _FPU_LAZY_H
+#define _FPU_LAZY_H
+
+/* ==================== 头文件包含 ==================== */
+#include <cpu.h>
+#include <ttos.h>
+
+/* ==================== 宏定义 ==================== */
+
+/**
+ * @brief 惰性切换管理的EUEN使能位集合
+ */
+#define LAZY_FPU_EUEN_MASK ((unsigned int)(CSR_EUEN_FPEN | CSR_EUEN_LSXEN | CSR_EUEN_LASXEN))
+
+/* ==================== 外部函数声明 ==================== */
+
+/**
+ * @brief 任务切出时的惰性浮点处理
+ *
+ * @details 仅在任务本轮真正使用过浮点/向量单元（EUEN相应位已打开）
+ *          时按最宽已使能单元保存状态，并记录本CPU最后拥有者，
+ *          随后关断使能位；未使用过则零开销直接返回
+ *
+ * @param task 切出任务的控制块指针（不能为NULL）
+ *
+ * @note 必须在关中断的任务切换路径中调用
+ */
+extern void lazy_fpu_switch_out(TASK_ID task);
+
+/**
+ * @brief 首次使用陷入时的惰性浮点换入
+ *
+ * @details 由FPDIS/LSXDIS/LASXDIS异常处理调用：打开请求的EUEN使能位，
+ *          若本CPU最后拥有者即当前任务且寄存器宽度足够则免恢复，
+ *          否则从任务上下文换入相应宽度的状态
+ *
+ * @param task 当前任务的控制块指针（不能为NULL）
+ * @param euen_mask 请求打开的EUEN使能位（LAZY_FPU_EUEN_MASK的子集）
+ *
+ * @note 必须在异常上下文（关中断）中调用
+ */
+extern void lazy_fpu_own(TASK_ID task, unsigned int euen_mask);
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _FPU_LAZY_H */
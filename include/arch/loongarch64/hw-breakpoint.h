@@ -0,0 +1,169 @@
+/**
+ * @file    hw-breakpoint.h
+ * @brief   LoongArch64硬件断点/观察点引擎接口
+ * @author  Intewell Team
+ * @date    2025-08-29
+ * @version 1.0
+ *
+ * @details 本文件定义硬件调试寄存器的分配与管理接口
+ *          - 取指断点（IBnADDR/IBnMASK/IBnCTRL组）
+ *          - 访存观察点（DBnADDR/DBnMASK/DBnCTRL组）
+ *          - 基于全掩码取指断点的硬件单步
+ *          断点状态保存在进程控制块，随上下文切换恢复，
+ *          全程不改写指令流、不刷新I-cache
+ *
+ * @note MISRA-C:2012 合规
+ * @note 观察点在用户态触发依赖PRMD.PWE（见CSR_PRMD_USER_INIT）
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _HW_BREAKPOINT_H
+#define _HW_BREAKPOINT_H
+
+/* ==================== 头文件包含 ==================== */
+#include <stdint.h>
+#include <system/types.h>
+#include <ttosProcess.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/* ==================== 宏定义 ==================== */
+
+/**
+ * @brief 调试配置/状态CSR编号（未由公共头定义时补充）
+ */
+#ifndef LOONGARCH_CSR_FWPC
+#define LOONGARCH_CSR_FWPC 0x98 /**< 取指断点配置（低6位为实现个数） */
+#endif
+#ifndef LOONGARCH_CSR_FWPS
+#define LOONGARCH_CSR_FWPS 0x99 /**< 取指断点状态（命中位图） */
+#endif
+#ifndef LOONGARCH_CSR_MWPC
+#define LOONGARCH_CSR_MWPC 0x9a /**< 访存观察点配置（低6位为实现个数） */
+#endif
+#ifndef LOONGARCH_CSR_MWPS
+#define LOONGARCH_CSR_MWPS 0x9b /**< 访存观察点状态（命中位图） */
+#endif
+
+/**
+ * @brief 调试寄存器组基址与步长：第n组 = 基址 + (n << 3)
+ */
+#define LOONGARCH_CSR_DB0ADDR 0x310 /**< 访存观察点0地址 */
+#define LOONGARCH_CSR_DB0MASK 0x311 /**< 访存观察点0掩码 */
+#define LOONGARCH_CSR_DB0CTRL 0x312 /**< 访存观察点0控制 */
+#define LOONGARCH_CSR_DB0ASID 0x313 /**< 访存观察点0 ASID */
+#define LOONGARCH_CSR_IB0ADDR 0x390 /**< 取指断点0地址 */
+#define LOONGARCH_CSR_IB0MASK 0x391 /**< 取指断点0掩码 */
+#define LOONGARCH_CSR_IB0CTRL 0x392 /**< 取指断点0控制 */
+#define LOONGARCH_CSR_IB0ASID 0x393 /**< 取指断点0 ASID */
+
+/**
+ * @brief 控制寄存器位定义
+ */
+#define HW_DBG_CTRL_PLV3_EN (1UL << 4) /**< 用户态（PLV3）使能 */
+#define HW_DBG_CTRL_LOAD_EN (1UL << 8) /**< 观察点：命中加载访问 */
+#define HW_DBG_CTRL_STORE_EN (1UL << 9) /**< 观察点：命中存储访问 */
+
+/**
+ * @brief 观察点访问类型（hw_watchpoint_install的type参数）
+ */
+#define HW_WP_TYPE_READ 0x1U  /**< 读观察 */
+#define HW_WP_TYPE_WRITE 0x2U /**< 写观察 */
+
+/**
+ * @brief 引擎支持的最大断点/观察点组数（实际以FWPC/MWPC上报为准）
+ */
+#define HW_DBG_SLOT_MAX 8
+
+/* ==================== 外部函数声明 ==================== */
+
+/**
+ * @brief 清除本核所有硬件断点与观察点
+ *
+ * @details 关闭全部IBn/DBn控制寄存器并清除命中状态，
+ *          进程切换到无调试状态或系统复位调试状态时调用
+ */
+extern void hw_debug_clear_all(void);
+
+/**
+ * @brief 安装取指断点
+ *
+ * @details 在进程调试状态中分配一个空闲取指断点组并记录地址，
+ *          实际写入硬件由hw_debug_restore在恢复该进程时完成
+ *
+ * @param pcb  目标进程控制块（不能为NULL）
+ * @param addr 断点地址（指令地址，4字节对齐）
+ *
+ * @return 成功返回分配的组号，无空闲组返回-ENOSPC，参数非法返回-EINVAL
+ */
+extern s32 hw_breakpoint_install(pcb_t pcb, uintptr_t addr);
+
+/**
+ * @brief 移除取指断点
+ *
+ * @param pcb  目标进程控制块（不能为NULL）
+ * @param addr 安装时的断点地址
+ *
+ * @return 成功返回0，未找到返回-ENOENT，参数非法返回-EINVAL
+ */
+extern s32 hw_breakpoint_remove(pcb_t pcb, uintptr_t addr);
+
+/**
+ * @brief 安装访存观察点
+ *
+ * @param pcb  目标进程控制块（不能为NULL）
+ * @param addr 观察地址
+ * @param type 访问类型（HW_WP_TYPE_READ/HW_WP_TYPE_WRITE可组合）
+ *
+ * @return 成功返回分配的组号，无空闲组返回-ENOSPC，参数非法返回-EINVAL
+ */
+extern s32 hw_watchpoint_install(pcb_t pcb, uintptr_t addr, u32 type);
+
+/**
+ * @brief 移除访存观察点
+ *
+ * @param pcb  目标进程控制块（不能为NULL）
+ * @param addr 安装时的观察地址
+ *
+ * @return 成功返回0，未找到返回-ENOENT，参数非法返回-EINVAL
+ */
+extern s32 hw_watchpoint_remove(pcb_t pcb, uintptr_t addr);
+
+/**
+ * @brief 使能硬件单步
+ *
+ * @details 在保留的最高取指断点组安装全掩码断点（掩码全1，
+ *          任意取指地址命中），被跟踪进程恢复后执行一条指令
+ *          即触发调试异常，全程不改写指令流、不刷新I-cache
+ *
+ * @param pcb 目标进程控制块（不能为NULL）
+ */
+extern void hw_single_step_enable(pcb_t pcb);
+
+/**
+ * @brief 关闭硬件单步
+ *
+ * @param pcb 目标进程控制块（不能为NULL）
+ */
+extern void hw_single_step_disable(pcb_t pcb);
+
+/**
+ * @brief 把进程的调试状态写入硬件
+ *
+ * @details 上下文切换到被调试进程时调用：按进程调试状态
+ *          逐组写入地址/掩码/控制寄存器，未使用的组关闭
+ *
+ * @param pcb 目标进程控制块（不能为NULL）
+ */
+extern void hw_debug_restore(pcb_t pcb);
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _HW_BREAKPOINT_H */
@@ -29,6 +29,7 @@
 #include <errno.h>
 #include <pageTable.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <system/types.h>
 
 /************************宏 定 义******************************/
@@ -143,6 +144,76 @@
 
 /** @} */
 
+/**
+ * @defgroup RelaxedIO 宽松序I/O读写
+ * @{
+ */
+
+/**
+ * @brief 宽松序I/O读接口（无屏障）
+ *
+ * @details 仅保证volatile访问本身，不插入dbar；适用于同一
+ *          设备寄存器间无顺序依赖的连续访问，驱动在依赖点
+ *          显式调用io_flush/io_sync收序
+ */
+#define readb_relaxed(c) arch_readb(c)
+#define readw_relaxed(c) arch_readw(c)
+#define readl_relaxed(c) arch_readl(c)
+#define readq_relaxed(c) arch_readq(c)
+
+/**
+ * @brief 宽松序I/O写接口（无屏障）
+ *
+ * @details 连续多寄存器写可全部使用relaxed版本，末尾一次
+ *          io_flush统一收序，替代每写一次屏障的模式
+ */
+#define writeb_relaxed(v, c) arch_writeb((v), (c))
+#define writew_relaxed(v, c) arch_writew((v), (c))
+#define writel_relaxed(v, c) arch_writel((v), (c))
+#define writeq_relaxed(v, c) arch_writeq((v), (c))
+
+/**
+ * @brief 显式写收序原语
+ *
+ * @details 保证之前所有relaxed写对设备可见后才执行后续访问，
+ *          典型用法：批量写寄存器→io_flush→写doorbell
+ */
+#define io_flush() iowmb()
+
+/**
+ * @brief 显式读收序原语
+ *
+ * @details 保证之前所有relaxed读完成后才执行后续访问
+ */
+#define io_sync() iormb()
+
+/** @} */
+
+/**
+ * @defgroup BatchIO 批量MMIO写
+ * @{
+ */
+
+/**
+ * @brief 批量MMIO写描述项（32位）
+ */
+struct mmio_w32
+{
+    volatile void *addr; /**< @brief 寄存器地址 */
+    u32 val;             /**< @brief 写入值 */
+};
+
+/**
+ * @brief 批量MMIO写描述项（64位）
+ */
+struct mmio_w64
+{
+    volatile void *addr; /**< @brief 寄存器地址 */
+    u64 val;             /**< @brief 写入值 */
+};
+
+/** @} */
+
 /**
  * @defgroup ByteSwap 字节序转换
  * @{
@@ -369,6 +440,49 @@ static inline void *ioremap_prot(phys_addr_t offset, unsigned long size, unsigne
 /** @} */
 
 /************************内联函数******************************/
+
+/**
+ * @brief 批量提交32位MMIO写（末尾统一屏障）
+ *
+ * @details 按数组顺序以宽松序写入全部寄存器，仅在末尾插入
+ *          一次写屏障；n个寄存器的提交由n次dbar降为1次
+ *
+ * @param ops 写描述数组（不能为NULL）
+ * @param n   描述项个数
+ *
+ * @note 性能关键路径：各项之间不保证到达设备的先后顺序，
+ *       有顺序依赖的寄存器（如doorbell）应放在批量提交之后
+ *       单独用writel写入
+ */
+static inline void writel_batch(const struct mmio_w32 *ops, size_t n)
+{
+    size_t i;
+
+    for (i = 0U; i < n; i++)
+    {
+        arch_writel(ops[i].val, ops[i].addr);
+    }
+    io_flush();
+}
+
+/**
+ * @brief 批量提交64位MMIO写（末尾统一屏障）
+ *
+ * @param ops 写描述数组（不能为NULL）
+ * @param n   描述项个数
+ *
+ * @note 语义与writel_batch相同
+ */
+static inline void writeq_batch(const struct mmio_w64 *ops, size_t n)
+{
+    size_t i;
+
+    for (i = 0U; i < n; i++)
+    {
+        arch_writeq(ops[i].val, ops[i].addr);
+    }
+    io_flush();
+}
 /************************C++兼容性******************************/
 #ifdef __cplusplus
 extern "C"
@@ -41,8 +41,28 @@
  */
 #define GENERAL_IPI_CALL (CPU_IPI0 + 2U)
 
+/**
+ * @brief 通用IPI TLB击落中断
+ */
+#define GENERAL_IPI_TLB_FLUSH (CPU_IPI0 + 3U)
+
+/**
+ * @brief 通用IPI跨核backtrace快照中断
+ */
+#define GENERAL_IPI_BACKTRACE (CPU_IPI0 + 4U)
+
 /** @} */
 
+/**
+ * @brief 跨核backtrace快照最大深度
+ */
+#define IPI_BACKTRACE_DEPTH 20U
+
+/**
+ * @brief 跨CPU函数调用请求队列深度（每对CPU，必须是2的幂）
+ */
+#define IPI_CALL_QUEUE_DEPTH 8U
+
 /************************类型定义******************************/
 
 /**
@@ -50,6 +70,14 @@
  */
 typedef struct cpu_set_t cpu_set_t;
 
+/**
+ * @brief 跨CPU调用函数类型
+ *
+ * @details 在目标核中断上下文执行，须遵守中断上下文约束
+ *          （不得睡眠、不得长时间占用）
+ */
+typedef void (*smp_call_fn)(void *arg);
+
 /************************外部变量******************************/
 /************************外部函数******************************/
 
@@ -82,6 +110,104 @@ s32 ipi_reschedule(cpu_set_t *cpus, bool selfexcluded);
  */
 void ipi_reschedule_handler(u32 irq, void *param);
 
+/**
+ * @brief 发送精确范围TLB击落IPI并同步等待完成
+ *
+ * @details 携带(asid, vaddr, size)载荷，接收核按页invtlb无效化
+ *
+ * @param cpus         目标CPU集合。为0时，表示系统中已经使能的CPU
+ * @param asid         地址空间标识（硬件ASID）
+ * @param vaddr        起始虚拟地址（页对齐）
+ * @param size         范围长度（字节）。为0时退化为用户空间全量刷新
+ *
+ * @return 成功返回0，失败返回错误码
+ */
+s32 ipi_tlb_flush_range(cpu_set_t *cpus, unsigned long asid, unsigned long vaddr, unsigned long size);
+
+/**
+ * @brief TLB击落IPI中断处理函数
+ *
+ * @details 按载荷中的地址范围逐页无效化本核TLB并应答发送核
+ *
+ * @param irq  中断号
+ * @param param 参数
+ *
+ * @return 无
+ */
+void ipi_tlb_flush_handler(u32 irq, void *param);
+
+/**
+ * @brief 发起跨核backtrace快照并收集输出
+ *
+ * @details 向目标CPU集合发送GENERAL_IPI_BACKTRACE，目标核在中断中
+ *          把调用栈写入per-CPU快照缓冲，发起核有界轮询收集并符号化
+ *          输出；全程不停机、不加全局锁，目标核无响应时跳过并提示
+ *
+ * @param cpus         目标CPU集合。为0时，表示系统中已经使能的CPU
+ * @param selfexcluded 是否排除当前CPU（本核直接回溯，不经IPI）
+ *
+ * @return 成功返回0，无目标CPU返回-EIO
+ */
+s32 ipi_cpu_backtrace(cpu_set_t *cpus, bool selfexcluded);
+
+/**
+ * @brief 跨核backtrace快照IPI中断处理函数
+ *
+ * @details 在目标核中断上下文捕获调用栈到本核快照缓冲并置完成标志
+ *
+ * @param irq  中断号
+ * @param param 参数
+ *
+ * @return 无
+ */
+void ipi_backtrace_handler(u32 irq, void *param);
+
+/**
+ * @brief 在指定CPU上执行函数
+ *
+ * @details 把(func, arg)入队到per-CPU对的SPSC请求队列并发送
+ *          GENERAL_IPI_CALL，目标核在中断上下文执行；目标为本核时
+ *          直接关中断执行，不经IPI
+ *
+ * @param cpu  目标CPU编号
+ * @param func 要执行的函数（在目标核中断上下文运行）
+ * @param arg  传给func的参数
+ * @param wait 是否同步等待执行完成（fire-and-forget传false）
+ *
+ * @return 成功返回0，参数无效返回-EINVAL，队列满返回-EAGAIN
+ *
+ * @note wait为true时等待期间本核保持开中断，可响应对端的调用请求，
+ *       两核互相同步调用不会死锁
+ */
+s32 smp_call_function_single(int cpu, smp_call_fn func, void *arg, bool wait);
+
+/**
+ * @brief 在CPU集合上执行函数
+ *
+ * @details 向集合内每个核入队请求并发送GENERAL_IPI_CALL；
+ *          本核在集合内时直接执行
+ *
+ * @param cpus 目标CPU集合。为0时，表示系统中已经使能的CPU
+ * @param func 要执行的函数（在目标核中断上下文运行）
+ * @param arg  传给func的参数
+ * @param wait 是否同步等待所有目标核执行完成
+ *
+ * @return 成功返回0，参数无效返回-EINVAL，任一目标队列满返回-EAGAIN
+ */
+s32 smp_call_function_mask(cpu_set_t *cpus, smp_call_fn func, void *arg, bool wait);
+
+/**
+ * @brief 跨CPU函数调用IPI中断处理函数
+ *
+ * @details 逐个排空本核的所有来源队列并执行其中的请求
+ *
+ * @param irq  中断号
+ * @param param 参数
+ *
+ * @return 无
+ */
+void ipi_call_handler(u32 irq, void *param);
+
 /** @} */
 
 /************************内联函数******************************/
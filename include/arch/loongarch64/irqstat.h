@@ -0,0 +1,182 @@
+/**
+ * @file    irqstat.h
+ * @brief   per-CPU异常/中断/系统调用统计接口
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件定义per-CPU中断与异常统计面板
+ *          - 按异常码（EXCCODE）与中断号分槽记录：次数、累计周期
+ *            （rdtime差值）、最大单次耗时
+ *          - per-CPU数组缓存行对齐，热路径只写本核数据，无锁
+ *            无原子操作；记录开销为两次加法加一次比较
+ *          - 提供只读查询与按核klog汇总导出，用于中断风暴定位
+ *
+ * @note MISRA-C:2012 合规
+ * @note 计数器为本核私有，跨核读取为近似快照，定位热点足够
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _IRQSTAT_H
+#define _IRQSTAT_H
+
+/* ==================== 头文件包含 ==================== */
+#include <system/types.h>
+
+/* ==================== 宏定义 ==================== */
+
+/**
+ * @brief 异常码统计槽数（覆盖全部同步异常码）
+ */
+#define IRQSTAT_EXC_SLOTS 64U
+
+/**
+ * @brief 中断号统计槽数（末槽兼作越界溢出槽）
+ */
+#define IRQSTAT_IRQ_SLOTS 128U
+
+/* ==================== 数据结构 ==================== */
+
+/**
+ * @brief 单槽统计项
+ */
+struct irqstat_entry
+{
+    u64 count;      /**< @brief 触发次数 */
+    u64 cycles;     /**< @brief 累计耗时（rdtime周期） */
+    u64 max_cycles; /**< @brief 最大单次耗时（rdtime周期） */
+};
+
+/**
+ * @brief per-CPU统计面板
+ *
+ * @details 缓存行对齐，避免相邻核计数器伪共享
+ */
+struct irqstat_cpu
+{
+    struct irqstat_entry exc[IRQSTAT_EXC_SLOTS]; /**< @brief 按异常码统计 */
+    struct irqstat_entry irq[IRQSTAT_IRQ_SLOTS]; /**< @brief 按中断号统计 */
+    struct irqstat_entry syscall;                /**< @brief 系统调用汇总 */
+} __attribute__((aligned(64)));
+
+/* ==================== 外部变量 ==================== */
+extern struct irqstat_cpu g_irqstat[];
+
+/* ==================== 内联函数 ==================== */
+
+/**
+ * @brief 记录一次事件到统计槽
+ *
+ * @details 次数与累计周期各一次自增，另维护最大单次耗时
+ *
+ * @param entry 统计槽
+ * @param delta 本次耗时（rdtime周期）
+ *
+ * @note 性能关键路径：只写本核数据，调用方保证entry有效
+ */
+static inline void irqstat_record(struct irqstat_entry *entry, u64 delta)
+{
+    entry->count++;
+    entry->cycles += delta;
+    if (delta > entry->max_cycles)
+    {
+        entry->max_cycles = delta;
+    }
+}
+
+/**
+ * @brief 记录一次中断处理
+ *
+ * @param cpu   本核CPU编号
+ * @param irq   中断号（越界计入末槽）
+ * @param delta 本次处理耗时（rdtime周期）
+ */
+static inline void irqstat_irq_record(u32 cpu, u32 irq, u64 delta)
+{
+    if (irq >= IRQSTAT_IRQ_SLOTS)
+    {
+        irq = IRQSTAT_IRQ_SLOTS - 1U;
+    }
+    irqstat_record(&g_irqstat[cpu].irq[irq], delta);
+}
+
+/**
+ * @brief 记录一次异常处理
+ *
+ * @param cpu   本核CPU编号
+ * @param ecode 异常码（越界计入末槽）
+ * @param delta 本次处理耗时（rdtime周期，不可测时传0）
+ */
+static inline void irqstat_exc_record(u32 cpu, u32 ecode, u64 delta)
+{
+    if (ecode >= IRQSTAT_EXC_SLOTS)
+    {
+        ecode = IRQSTAT_EXC_SLOTS - 1U;
+    }
+    irqstat_record(&g_irqstat[cpu].exc[ecode], delta);
+}
+
+/**
+ * @brief 记录一次系统调用
+ *
+ * @param cpu   本核CPU编号
+ * @param delta 本次处理耗时（rdtime周期）
+ */
+static inline void irqstat_syscall_record(u32 cpu, u64 delta)
+{
+    irqstat_record(&g_irqstat[cpu].syscall, delta);
+}
+
+/* ==================== 外部函数声明 ==================== */
+
+/**
+ * @brief 只读查询指定核的中断统计
+ *
+ * @param cpu 目标CPU编号
+ * @param irq 中断号
+ * @param out 统计输出
+ *
+ * @return 成功返回0，参数无效返回-EINVAL
+ */
+extern s32 irqstat_irq_get(u32 cpu, u32 irq, struct irqstat_entry *out);
+
+/**
+ * @brief 只读查询指定核的异常统计
+ *
+ * @param cpu   目标CPU编号
+ * @param ecode 异常码
+ * @param out   统计输出
+ *
+ * @return 成功返回0，参数无效返回-EINVAL
+ */
+extern s32 irqstat_exc_get(u32 cpu, u32 ecode, struct irqstat_entry *out);
+
+/**
+ * @brief 只读查询指定核的系统调用统计
+ *
+ * @param cpu 目标CPU编号
+ * @param out 统计输出
+ *
+ * @return 成功返回0，参数无效返回-EINVAL
+ */
+extern s32 irqstat_syscall_get(u32 cpu, struct irqstat_entry *out);
+
+/**
+ * @brief 按核经klog汇总导出非零统计槽
+ *
+ * @param cpu 目标CPU编号
+ */
+extern void irqstat_dump(u32 cpu);
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _IRQSTAT_H */
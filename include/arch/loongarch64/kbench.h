@@ -0,0 +1,76 @@
+/**
+ * @file    kbench.h
+ * @brief   内核延迟基准套件接口
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件定义内建延迟基准套件接口
+ *          - 上下文切换往返：tbspSaveTaskContext→tbspRestoreTaskContext
+ *            全量路径与快速路径各测一组
+ *          - 中断分发延迟：do_irq入口到首个handler分发的周期分布，
+ *            从真实中断被动采集
+ *          - null syscall往返：经syscall指令完整陷入/返回一次的周期
+ *          - 全部用rdtime.d计时，输出min/p50/p99/max与对数直方图，
+ *            经klog导出，便于建立性能回归基线
+ *
+ * @note MISRA-C:2012 合规
+ * @note 基准未运行时中断路径开销为单次分支
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _KBENCH_H
+#define _KBENCH_H
+
+/* ==================== 头文件包含 ==================== */
+#include <system/types.h>
+
+/* ==================== 外部函数声明 ==================== */
+
+/**
+ * @brief 运行延迟基准套件
+ *
+ * @details 依次执行上下文切换、中断分发、null syscall基准，
+ *          结果经klog输出；须在任务上下文、系统进入稳态后调用
+ *
+ * @param syscall_num 用于null syscall基准的空闲系统调用号
+ *                    （基准期间临时安装空处理函数）；传负值跳过
+ *                    该项基准
+ *
+ * @return 成功返回0，失败返回负错误码
+ *
+ * @note 上下文切换基准在关中断窗口内执行，单组1024次往返
+ */
+extern s32 kbench_run(s32 syscall_num);
+
+/**
+ * @brief 中断分发基准：do_irq入口打点
+ *
+ * @details 由do_irq在函数入口调用；基准未武装时单次分支返回0
+ *
+ * @return 基准武装时返回入口时间戳，否则返回0
+ */
+extern u64 kbench_irq_entry(void);
+
+/**
+ * @brief 中断分发基准：handler分发打点
+ *
+ * @details 由do_irq在首次分发中断处理函数前调用，
+ *          记录入口到分发的周期差
+ *
+ * @param entry_tsc kbench_irq_entry返回的入口时间戳（0表示跳过）
+ */
+extern void kbench_irq_dispatch(u64 entry_tsc);
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _KBENCH_H */
@@ -0,0 +1,103 @@
+/**
+ * @file    klog-ring.h
+ * @brief   LoongArch64 per-CPU无锁日志环形缓冲接口
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件定义per-CPU无锁日志环形缓冲接口
+ *          - 定长记录加单调序号，入队只拷贝格式串指针和原始参数，
+ *            格式化推迟到刷出时执行（延迟格式化）
+ *          - 中断/异常上下文只做入队，耗时的串口输出由低优先级
+ *            任务调用刷出接口批量完成
+ *          - 保留panic时的同步转储路径，确保崩溃现场日志不丢失
+ *
+ * @note MISRA-C:2012 合规
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _KLOG_RING_H
+#define _KLOG_RING_H
+
+/* ==================== 头文件包含 ==================== */
+
+/* ==================== 宏定义 ==================== */
+
+/* 单条记录携带的原始参数个数 */
+#define KLOG_RING_ARG_MAX   4U
+
+/* ==================== 外部函数声明 ==================== */
+
+/**
+ * @brief 日志记录入队
+ *
+ * @details 将一条日志记录写入本CPU的环形缓冲，只保存格式串指针、
+ *          原始参数、级别和时间戳，不在此处做任何格式化和串口输出
+ *
+ * @param level 日志级别（klog_level枚举值）
+ * @param fmt 格式串（必须是字符串字面量，生存期贯穿整个运行期）
+ * @param arg0 原始参数1
+ * @param arg1 原始参数2
+ * @param arg2 原始参数3
+ * @param arg3 原始参数4
+ *
+ * @return 无
+ *
+ * @note 可在任务、中断和异常上下文调用，缓冲满时丢弃并计数
+ * @note 格式串仅支持%s、%c、%d、%u、%x、%p和%%
+ * @warning %s参数指向的字符串必须在刷出前保持有效（建议只传字面量）
+ */
+extern void klog_ring_put(int level, const char *fmt, long arg0, long arg1, long arg2, long arg3);
+
+/**
+ * @brief 批量刷出所有CPU的待输出日志
+ *
+ * @details 按序号完成延迟格式化并写串口，供低优先级日志任务
+ *          周期调用；同时报告期间因缓冲满而丢弃的记录数
+ *
+ * @return 无
+ *
+ * @note 只应由单一刷出任务调用（每个环的消费端唯一）
+ */
+extern void klog_ring_flush(void);
+
+/**
+ * @brief panic时同步转储残留日志
+ *
+ * @details 崩溃路径专用：立即同步刷出所有CPU缓冲中的残留记录，
+ *          不依赖日志任务调度
+ *
+ * @return 无
+ *
+ * @note 仅限不可恢复错误路径调用，可能与刷出任务竞争消费指针
+ */
+extern void klog_ring_panic_dump(void);
+
+/**
+ * @brief 二进制快照全部CPU的环形缓冲
+ *
+ * @details 崩溃快存路径专用：把各CPU环的原始记录（含读写指针
+ *          与序号）整块拷贝到目标缓冲，不做格式化和串口输出，
+ *          重启后由离线工具结合内核镜像解析格式串指针
+ *
+ * @param dst 目标缓冲
+ * @param max_bytes 目标缓冲容量（字节）
+ *
+ * @return 实际拷贝的字节数（容量不足时按整环截断）
+ *
+ * @note 仅限不可恢复错误路径调用，不与生产者同步
+ */
+extern unsigned int klog_ring_snapshot(void *dst, unsigned int max_bytes);
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _KLOG_RING_H */
@@ -0,0 +1,111 @@
+/**
+ * @file    kprofile.h
+ * @brief   定时器采样剖析器接口
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件定义基于定时器中断的内核采样剖析器接口
+ *          - 按可配置分频在定时器中断中记录被打断的PC与调用栈摘要
+ *          - 样本写入per-CPU环形缓冲，采样路径无锁
+ *          - 读取接口按CPU导出样本，用于生成火焰图数据
+ *
+ * @note MISRA-C:2012 合规
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _KPROFILE_H
+#define _KPROFILE_H
+
+/* ==================== 头文件包含 ==================== */
+#include <stdint.h>
+
+/* ==================== 宏定义 ==================== */
+
+/**
+ * @brief 单个样本记录的调用栈摘要深度
+ */
+#define KPROFILE_STACK_DEPTH 8U
+
+/* ==================== 数据结构 ==================== */
+
+/**
+ * @brief 剖析样本记录
+ *
+ * @details 定时器中断采集的单个样本：时间戳、被打断的PC
+ *          和从中断处理路径回溯得到的调用栈摘要
+ */
+struct kprofile_sample
+{
+    unsigned long long tsc;                /**< @brief 采样时间戳（rdtime计数） */
+    uintptr_t pc;                          /**< @brief 被打断时的PC（异常返回地址） */
+    unsigned int depth;                    /**< @brief 调用栈摘要有效层数 */
+    uintptr_t stack[KPROFILE_STACK_DEPTH]; /**< @brief 调用栈摘要（调用点地址） */
+};
+
+/* ==================== 外部函数声明 ==================== */
+
+/**
+ * @brief 启动采样剖析
+ *
+ * @details 设置采样分频并使能采样：每divisor次定时器中断采集一个样本
+ *
+ * @param divisor 采样分频（大于等于1；定时器1000Hz、divisor为10时采样率100Hz）
+ *
+ * @return 成功返回0，分频为0返回-EINVAL
+ */
+extern int kprofile_start(unsigned int divisor);
+
+/**
+ * @brief 停止采样剖析
+ *
+ * @details 关闭采样；已入环的样本保留，可继续读出
+ */
+extern void kprofile_stop(void);
+
+/**
+ * @brief 定时器中断采样入口
+ *
+ * @details 定时器中断处理函数中调用；未使能时单次分支返回，
+ *          使能时按分频采集被打断的PC与调用栈摘要入本核环形缓冲
+ *
+ * @note 性能关键路径：只在本核中断上下文执行，无锁
+ */
+extern void kprofile_timer_sample(void);
+
+/**
+ * @brief 读取指定CPU的样本
+ *
+ * @details 从目标CPU的环形缓冲中取出最多max个样本（取出即消费）
+ *
+ * @param cpu 目标CPU编号
+ * @param out 输出样本数组
+ * @param max 最多取出的样本数
+ *
+ * @return 实际取出的样本数，参数无效返回-EINVAL
+ *
+ * @note 每个CPU环的消费端必须唯一（单一导出任务）
+ */
+extern int kprofile_read(unsigned int cpu, struct kprofile_sample *out, unsigned int max);
+
+/**
+ * @brief 查询指定CPU因缓冲满丢弃的样本数
+ *
+ * @param cpu 目标CPU编号
+ *
+ * @return 丢弃样本累计数，参数无效返回0
+ */
+extern unsigned int kprofile_dropped(unsigned int cpu);
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _KPROFILE_H */
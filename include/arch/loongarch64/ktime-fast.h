@@ -0,0 +1,65 @@
+/**
+ * @file    ktime-fast.h
+ * @brief   快速时间戳接口（mult/shift定点折算）
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件提供全内核可用的快速纳秒时间戳接口
+ *          - 系数在定时器频率初始化时预计算（loongarch_timer.c），
+ *            热路径仅rdtime.d加一次128位乘法和移位，无除法
+ *          - 供追踪等每秒取数百万次时间戳的子系统内联使用
+ *
+ * @note MISRA-C:2012 合规
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _KTIME_FAST_H
+#define _KTIME_FAST_H
+
+/* ==================== 头文件包含 ==================== */
+#include <cpu.h>
+#include <system/types.h>
+
+/* ==================== 外部变量 ==================== */
+
+/**
+ * @brief walltime折算定点乘数（启动时按定时器频率预计算）
+ */
+extern u64 g_ktime_fast_mult;
+
+/**
+ * @brief walltime折算右移位数
+ */
+extern u32 g_ktime_fast_shift;
+
+/* ==================== 内联函数 ==================== */
+
+/**
+ * @brief 快速获取当前纳秒时间戳
+ *
+ * @details 读取稳定计数器并用预计算的mult/shift系数折算成纳秒，
+ *          ns = (count * mult) >> shift，128位乘法由mulh.d/mul.d
+ *          两条指令完成
+ *
+ * @return 当前纳秒时间戳；系数未初始化时返回0
+ *
+ * @note 性能关键路径：无除法、无锁、无函数调用开销
+ */
+static inline u64 ktime_get_fast(void)
+{
+    return (u64)(((__uint128_t)drdtime() * g_ktime_fast_mult) >> g_ktime_fast_shift);
+}
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _KTIME_FAST_H */
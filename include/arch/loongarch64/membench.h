@@ -0,0 +1,61 @@
+/**
+ * @file    membench.h
+ * @brief   内存与缓存操作微基准套件接口
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件定义内存与缓存带宽/延迟基准套件接口
+ *          - dcache按范围写回/无效：按2的幂扫描尺寸曲线，覆盖
+ *            按行路径与全量路径的切换点
+ *          - memcpy/memset带宽：arch_memcpy_fast/arch_memset_fast
+ *            按尺寸扫描，量化向量路径在不同机型上的实际吞吐
+ *          - 原子操作争用吞吐：1~N核并发对同一缓存行执行原子加，
+ *            量化跨核缓存行迁移开销
+ *          - 全部用rdtime.d计时，结果经klog输出机器可读格式，
+ *            用于板级验收与机型间缓存行为对比
+ *
+ * @note MISRA-C:2012 合规
+ * @note 工作缓冲由调用方提供，尺寸决定扫描上限，应大于末级
+ *       缓存容量以覆盖内存带宽区间
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _MEMBENCH_H
+#define _MEMBENCH_H
+
+/* ==================== 头文件包含 ==================== */
+#include <stddef.h>
+#include <system/types.h>
+
+/* ==================== 外部函数声明 ==================== */
+
+/**
+ * @brief 运行内存与缓存基准套件
+ *
+ * @details 依次执行memcpy/memset带宽、dcache维护尺寸扫描、
+ *          原子操作争用吞吐基准，结果经klog输出；
+ *          须在任务上下文、系统进入稳态后调用
+ *
+ * @param buf 工作缓冲起始地址（必须缓存行对齐，内容会被覆盖）
+ * @param len 工作缓冲长度（字节，不小于两倍最小扫描尺寸）
+ *
+ * @return 成功返回0，参数无效返回-EINVAL
+ *
+ * @note 基准执行期间会产生大量缓存与总线流量，
+ *       不应与时延敏感负载并行运行
+ */
+extern s32 membench_run(void *buf, size_t len);
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MEMBENCH_H */
@@ -0,0 +1,73 @@
+/**
+ * @file    memfast.h
+ * @brief   向量化内存例程接口
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件定义基于LSX/LASX的大块内存例程对外接口
+ *          - arch_memcpy_fast: 大块拷贝快速路径
+ *          - arch_memset_fast: 大块填充快速路径
+ *          - 按cpu_probe探测结果运行时选择LSX/LASX或标量实现
+ *
+ * @note MISRA-C:2012 合规
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _MEMFAST_H
+#define _MEMFAST_H
+
+/* ==================== 头文件包含 ==================== */
+#include <stddef.h>
+
+/* ==================== 宏定义 ==================== */
+
+/**
+ * @brief 走向量快速路径的最小长度（小于一个缓存行仍走标量）
+ */
+#define MEM_FAST_MIN 64U
+
+/* ==================== 外部函数声明 ==================== */
+
+/**
+ * @brief 大块内存拷贝快速路径
+ *
+ * @details 长度达到MEM_FAST_MIN且CPU支持LSX/LASX时走向量拷贝，
+ *          否则退化为标准memcpy
+ *
+ * @param dst 目标地址
+ * @param src 源地址
+ * @param n 拷贝字节数
+ *
+ * @return 返回dst
+ *
+ * @note 源和目标区域不得重叠
+ */
+extern void *arch_memcpy_fast(void *dst, const void *src, size_t n);
+
+/**
+ * @brief 大块内存填充快速路径
+ *
+ * @details 长度达到MEM_FAST_MIN且CPU支持LSX/LASX时走向量填充，
+ *          否则退化为标准memset
+ *
+ * @param dst 目标地址
+ * @param value 填充字节值
+ * @param n 填充字节数
+ *
+ * @return 返回dst
+ */
+extern void *arch_memset_fast(void *dst, int value, size_t n);
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MEMFAST_H */
@@ -3,13 +3,13 @@
  * @brief   LoongArch64内存扫描接口
  * @author  Intewell Team
  * @date    2025-01-22
- * @version 1.1
+ * @version 1.2
  *
  * @details 本文件定义LoongArch64内存扫描相关接口
- *          - 内存区域扫描
- *          - 内存模式搜索
- *          - 内存完整性检查
- *          - 内存故障检测
+ *          - 启动内存清零范围登记
+ *          - 多核并行分发：范围切分为定长块，各核以原子
+ *            游标认领，arch_memset_fast向量化清零
+ *          - 主核原子计数汇合，配合启动耗时仪表验证收益
  *
  * @note MISRA-C:2012 合规
  * @note 本接口用于内存管理和调试工具
@@ -23,15 +23,66 @@
 #define _MEMORY_SCAN_H
 
 /************************头 文 件******************************/
+#include <stddef.h>
+#include <stdint.h>
+#include <system/types.h>
 
 /************************宏 定 义******************************/
 
+/**
+ * @brief 并行清零的认领块大小（字节）
+ *
+ * @details 块过小则原子游标争用上升，过大则尾部负载不均；
+ *          16MB在8核64GB机型上两者均可忽略
+ */
+#define MEM_SCAN_CHUNK_SIZE (16UL << 20)
+
+/**
+ * @brief 可登记的清零范围上限
+ */
+#define MEM_SCAN_RANGE_MAX 16U
+
 /************************类型定义******************************/
 
 /************************外部变量******************************/
 
 /************************外部函数******************************/
 
+/**
+ * @brief 登记一段待清零内存范围
+ *
+ * @details 主核在分发前调用，范围须已建立映射；
+ *          各范围按MEM_SCAN_CHUNK_SIZE切块统一编号
+ *
+ * @param start 范围起始虚拟地址
+ * @param size  范围长度（字节）
+ *
+ * @return 成功返回0，范围表已满返回-ENOSPC，参数非法返回-EINVAL
+ */
+extern s32 memory_scan_add_range(uintptr_t start, size_t size);
+
+/**
+ * @brief 分发并行清零并参与执行
+ *
+ * @details 主核调用：向全部已拉起的从核发认领IPI，随后自身
+ *          也进入认领循环直到块耗尽；各核经原子游标动态取块，
+ *          天然实现地址区间负载均衡
+ *
+ * @note 须在从核拉起（smp_boot_wait_all成功）之后调用
+ */
+extern void memory_scan_dispatch(void);
+
+/**
+ * @brief 等待并行清零汇合
+ *
+ * @details 主核自旋等待完成计数到达总块数
+ *
+ * @param timeout_ms 超时时间（毫秒）
+ *
+ * @return 成功返回0，超时返回-ETIMEDOUT
+ */
+extern s32 memory_scan_wait(u32 timeout_ms);
+
 /************************内联函数******************************/
 
 /************************C++兼容性******************************/
@@ -207,6 +207,17 @@ typedef struct fixmap_set_t
 /************************外部变量******************************/
 /************************外部函数******************************/
 
+/**
+ * @brief 内核虚拟地址转物理地址
+ *
+ * @details 查内核页表把内核虚拟地址折算成物理地址
+ *
+ * @param va 内核虚拟地址
+ *
+ * @return 物理地址，未映射返回0
+ */
+extern phys_addr_t kernel_v2p(virt_addr_t va);
+
 /************************内联函数******************************/
 
 /**
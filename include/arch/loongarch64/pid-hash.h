@@ -0,0 +1,95 @@
+/**
+ * @file    pid-hash.h
+ * @brief   pid到PCB的哈希索引接口
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件定义pid→pcb哈希索引与per-CPU当前进程指针接口
+ *          - 进程创建/退出时维护索引，查找侧无锁
+ *          - 替代进程表线性遍历，查找复杂度O(1)
+ *          - per-CPU当前进程指针在上下文切换时更新，直取无查找
+ *
+ * @note MISRA-C:2012 合规
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _PID_HASH_H
+#define _PID_HASH_H
+
+/* ==================== 头文件包含 ==================== */
+#include <ptrace/ptrace.h>
+#include <sys/types.h>
+
+/* ==================== 外部函数声明 ==================== */
+
+/**
+ * @brief 注册pid到PCB的映射
+ *
+ * @details 进程创建路径调用，把pid→pcb项插入哈希索引；
+ *          插入在锁内完成，发布顺序保证查找侧无锁可见
+ *
+ * @param pid 进程ID
+ * @param pcb 进程控制块指针
+ *
+ * @return 成功返回0，节点池耗尽返回-ENOMEM，参数无效返回-EINVAL
+ */
+extern int pid_hash_insert(pid_t pid, pcb_t pcb);
+
+/**
+ * @brief 注销pid映射
+ *
+ * @details 进程退出路径调用，从哈希索引中摘除对应项
+ *
+ * @param pid 进程ID
+ *
+ * @return 成功返回0，未找到返回-ESRCH
+ */
+extern int pid_hash_remove(pid_t pid);
+
+/**
+ * @brief 按pid查找PCB
+ *
+ * @details 读侧无锁：沿桶链遍历，不获取任何锁，
+ *          可在ptrace、信号发送等热路径频繁调用
+ *
+ * @param pid 进程ID
+ *
+ * @return 成功返回PCB指针，未找到返回NULL
+ *
+ * @note 调用方须保证目标进程在使用期间不被并发回收
+ */
+extern pcb_t pid_hash_lookup(pid_t pid);
+
+/**
+ * @brief 更新本CPU的当前进程指针
+ *
+ * @details 上下文切换路径调用，记录本CPU正在运行的进程
+ *
+ * @param pcb 当前进程控制块指针
+ *
+ * @return 无
+ */
+extern void pid_current_set(pcb_t pcb);
+
+/**
+ * @brief 获取本CPU的当前进程指针
+ *
+ * @details 直接读取per-CPU槽位，无查找开销
+ *
+ * @return 当前进程PCB指针，未设置时返回NULL
+ */
+extern pcb_t pid_current_get(void);
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PID_HASH_H */
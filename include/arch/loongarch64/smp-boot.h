@@ -0,0 +1,82 @@
+/**
+ * @file    smp-boot.h
+ * @brief   从核并行启动汇合接口
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件定义从核并行启动的汇合设施
+ *          - 主核一次性释放全部从核后，各从核并行执行本地
+ *            初始化（cpu_probe、异常/TLB handler安装、本地
+ *            定时器），就绪后以原子计数器汇合
+ *          - 仅真正需要序列化的全局步骤（如sync_counter校时）
+ *            经ticket锁串行执行，其余阶段全并行
+ *          - 主核以超时等待汇合，避免个别从核拉起失败时
+ *            永久阻塞启动
+ *
+ * @note MISRA-C:2012 合规
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _SMP_BOOT_H
+#define _SMP_BOOT_H
+
+/* ==================== 头文件包含 ==================== */
+#include <system/types.h>
+
+/* ==================== 外部函数声明 ==================== */
+
+/**
+ * @brief 武装从核启动汇合
+ *
+ * @details 主核在一次性释放全部从核之前调用，记录预期
+ *          汇合的从核数并清零就绪计数
+ *
+ * @param secondary_count 预期拉起的从核数
+ */
+extern void smp_boot_begin(u32 secondary_count);
+
+/**
+ * @brief 从核就绪汇合点
+ *
+ * @details 从核完成本地初始化后调用，原子递增就绪计数；
+ *          每核启动流程只调用一次
+ */
+extern void smp_boot_arrive(void);
+
+/**
+ * @brief 主核等待全部从核汇合
+ *
+ * @details 自旋等待就绪计数到达预期值
+ *
+ * @param timeout_ms 等待超时（毫秒）
+ *
+ * @return 全部就绪返回0，超时返回-ETIMEDOUT并附带已就绪核数日志
+ */
+extern s32 smp_boot_wait_all(u32 timeout_ms);
+
+/**
+ * @brief 进入启动期全局串行段
+ *
+ * @details 并行启动窗口内真正需要序列化的全局步骤
+ *          （如sync_counter校时）以此包围
+ */
+extern void smp_boot_serial_begin(void);
+
+/**
+ * @brief 离开启动期全局串行段
+ */
+extern void smp_boot_serial_end(void);
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SMP_BOOT_H */
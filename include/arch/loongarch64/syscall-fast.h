@@ -0,0 +1,71 @@
+/**
+ * @file    syscall-fast.h
+ * @brief   LoongArch64快速系统调用接口
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件定义快速系统调用注册接口
+ *          - 快速系统调用走轻量入口：只保存调用者保存寄存器，
+ *            不构建完整异常上下文帧
+ *          - 通过per-调用号标志数组在汇编入口分流
+ *          - 仅允许注册不触发调度、信号和阻塞的简单系统调用
+ *
+ * @note MISRA-C:2012 合规
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _SYSCALL_FAST_H
+#define _SYSCALL_FAST_H
+
+/* ==================== 头文件包含 ==================== */
+
+/* ==================== 宏定义 ==================== */
+
+/* ==================== 外部函数声明 ==================== */
+
+/**
+ * @brief 注册快速系统调用
+ *
+ * @details 将指定系统调用号标记为快速调用，后续该调用经轻量
+ *          入口执行：不保存静态寄存器、不保存完整CSR帧、
+ *          返回前不做信号与调度检查
+ *
+ * @param num 系统调用号（基础表范围内）
+ *
+ * @return 成功返回0，失败返回负错误码
+ *
+ * @retval 0 注册成功
+ * @retval -EINVAL 调用号越界或处理函数为空
+ *
+ * @warning 被注册的系统调用不得触发调度、信号投递或任何阻塞操作，
+ *          也不得访问异常上下文（如取时间、getpid类只读调用）
+ */
+extern int syscall_fast_register(int num);
+
+/**
+ * @brief 注销快速系统调用
+ *
+ * @details 将指定系统调用号恢复为完整帧慢路径
+ *
+ * @param num 系统调用号（基础表范围内）
+ *
+ * @return 成功返回0，失败返回负错误码
+ *
+ * @retval 0 注销成功
+ * @retval -EINVAL 调用号越界
+ */
+extern int syscall_fast_unregister(int num);
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SYSCALL_FAST_H */
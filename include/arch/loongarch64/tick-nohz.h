@@ -0,0 +1,65 @@
+/**
+ * @file    tick-nohz.h
+ * @brief   无滴答空闲模式（NO_HZ）接口
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件定义tickless空闲模式接口
+ *          - 核进入idle时按下一个最近到期事件编程单次定时器，
+ *            空闲期间不再被周期tick打断
+ *          - 退出idle时按实际流逝时间计算需要补偿的tick数，
+ *            由调用方（idle循环）完成jiffies补偿
+ *
+ * @note MISRA-C:2012 合规
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _TICK_NOHZ_H
+#define _TICK_NOHZ_H
+
+/* ==================== 头文件包含 ==================== */
+#include <system/types.h>
+
+/* ==================== 外部函数声明 ==================== */
+
+/**
+ * @brief 进入无滴答空闲
+ *
+ * @details 记录进入时刻并把本核定时器切换到单次模式，按下一个
+ *          最近到期事件编程触发时刻；到期事件早于一个tick周期时
+ *          不进入tickless，保持周期模式
+ *
+ * @param next_event_ns 下一个最近到期事件的相对时间（纳秒）；
+ *                      为0表示无未决事件，按最大睡眠时长编程
+ *
+ * @return 成功进入tickless返回0，到期过近未进入返回-EAGAIN
+ *
+ * @note 须在关中断的idle路径中调用
+ */
+extern s32 tick_nohz_idle_enter(u64 next_event_ns);
+
+/**
+ * @brief 退出无滴答空闲
+ *
+ * @details 恢复本核定时器周期模式，按实际流逝的时间计算空闲期间
+ *          错过的tick数，供调用方补偿jiffies
+ *
+ * @return 需要补偿的tick数；未处于tickless状态返回0
+ *
+ * @note 须在关中断的idle路径中调用（被中断唤醒后、开中断前）
+ */
+extern u32 tick_nohz_idle_exit(void);
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _TICK_NOHZ_H */
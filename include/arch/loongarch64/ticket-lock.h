@@ -0,0 +1,234 @@
+/**
+ * @file    ticket-lock.h
+ * @brief   公平ticket自旋锁（带退避与可选争用统计）
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件实现ticket排队自旋锁
+ *          - 取号/叫号协议保证FIFO公平，消除测试-设置锁在争用时
+ *            所有等待核反复弹跳同一缓存行引发的饥饿
+ *          - 等待环内用idle 0退避，降低总线流量与功耗
+ *          - 可选per-锁争用统计（CONFIG_TICKET_LOCK_STAT编译开关）：
+ *            获取次数、争用次数、累计自旋与持锁周期数；
+ *            关闭时字段与代码全部编译消除，零开销
+ *
+ * @note MISRA-C:2012 合规
+ * @note 性能关键路径：获取/释放全部内联，无函数调用开销
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _TICKET_LOCK_H
+#define _TICKET_LOCK_H
+
+/* ==================== 头文件包含 ==================== */
+#include <atomic.h>
+#include <barrier.h>
+#include <cpu.h>
+#include <system/types.h>
+
+/* ==================== 数据结构 ==================== */
+
+/**
+ * @brief ticket锁争用统计（编译开关控制）
+ */
+#ifdef CONFIG_TICKET_LOCK_STAT
+struct ticket_lock_stat
+{
+    u64 acquisitions; /**< @brief 获取总次数 */
+    u64 contentions;  /**< @brief 发生自旋等待的次数 */
+    u64 spin_cycles;  /**< @brief 累计自旋等待周期数 */
+    u64 hold_cycles;  /**< @brief 累计持锁周期数 */
+};
+#endif
+
+/**
+ * @brief ticket自旋锁
+ *
+ * @details next为取号计数（原子自增），owner为叫号计数
+ *          （仅持有者递增）；独占一条缓存行避免伪共享
+ */
+struct ticket_lock
+{
+    volatile int next;  /**< @brief 取号计数 */
+    volatile int owner; /**< @brief 叫号计数 */
+#ifdef CONFIG_TICKET_LOCK_STAT
+    struct ticket_lock_stat stat; /**< @brief 争用统计 */
+    u64 lock_tsc;                 /**< @brief 本次获取时刻（持有者私有） */
+#endif
+} __attribute__((aligned(64)));
+
+/* ==================== 宏定义 ==================== */
+
+/**
+ * @brief 定义并初始化ticket锁
+ */
+#define DEFINE_TICKET_LOCK(name) struct ticket_lock name = {0, 0}
+
+/* ==================== 内联函数 ==================== */
+
+/**
+ * @brief 初始化ticket锁
+ *
+ * @param lock 锁对象
+ */
+static inline void ticket_lock_init(struct ticket_lock *lock)
+{
+    lock->next = 0;
+    lock->owner = 0;
+#ifdef CONFIG_TICKET_LOCK_STAT
+    lock->stat.acquisitions = 0U;
+    lock->stat.contentions = 0U;
+    lock->stat.spin_cycles = 0U;
+    lock->stat.hold_cycles = 0U;
+    lock->lock_tsc = 0U;
+#endif
+}
+
+/**
+ * @brief 获取ticket锁
+ *
+ * @details 原子取号后自旋等待叫号到自己；等待环内用idle 0
+ *          退避，owner推进由持有者的普通存储完成，等待核只读
+ *          本地缓存副本，无缓存行弹跳
+ *
+ * @param lock 锁对象
+ *
+ * @note 性能关键路径：无争用时一条AM指令加一次比较
+ */
+static inline void ticket_lock_acquire(struct ticket_lock *lock)
+{
+    int my_ticket = atomic32_add(&lock->next, 1);
+
+#ifdef CONFIG_TICKET_LOCK_STAT
+    lock->stat.acquisitions++;
+    if (lock->owner != my_ticket)
+    {
+        u64 spin_start = drdtime();
+
+        lock->stat.contentions++;
+        while (lock->owner != my_ticket)
+        {
+            __asm__ volatile("idle 0");
+        }
+        lock->stat.spin_cycles += drdtime() - spin_start;
+    }
+    lock->lock_tsc = drdtime();
+#else
+    while (lock->owner != my_ticket)
+    {
+        __asm__ volatile("idle 0");
+    }
+#endif
+
+    /* 获取语义：临界区访问不得重排到叫号判定之前 */
+    smp_mb();
+}
+
+/**
+ * @brief 尝试获取ticket锁
+ *
+ * @details 仅在无人持有且无人排队时取号成功，不自旋
+ *
+ * @param lock 锁对象
+ *
+ * @return 获取成功返回1，锁被占用返回0
+ */
+static inline int ticket_lock_try_acquire(struct ticket_lock *lock)
+{
+    int cur = lock->owner;
+
+    if (lock->next != cur)
+    {
+        return 0;
+    }
+
+    if (atomic32_cas(&lock->next, cur, cur + 1) == 0)
+    {
+        return 0;
+    }
+
+#ifdef CONFIG_TICKET_LOCK_STAT
+    lock->stat.acquisitions++;
+    lock->lock_tsc = drdtime();
+#endif
+    smp_mb();
+
+    return 1;
+}
+
+/**
+ * @brief 释放ticket锁
+ *
+ * @details 叫号计数加一放行下一个排队者；owner仅由持有者写，
+ *          普通存储加释放屏障即可
+ *
+ * @param lock 锁对象
+ *
+ * @note 性能关键路径：一次屏障加一次普通存储
+ */
+static inline void ticket_lock_release(struct ticket_lock *lock)
+{
+#ifdef CONFIG_TICKET_LOCK_STAT
+    lock->stat.hold_cycles += drdtime() - lock->lock_tsc;
+#endif
+
+    /* 释放语义：临界区访问先于放行对外可见 */
+    smp_mb();
+    lock->owner = lock->owner + 1;
+}
+
+/**
+ * @brief 关中断获取ticket锁
+ *
+ * @param lock  锁对象
+ * @param flags 中断状态保存变量
+ */
+#define ticket_lock_acquire_irqsave(lock, flags) \
+    do                                           \
+    {                                            \
+        raw_local_irq_save(flags);               \
+        ticket_lock_acquire(lock);               \
+    } while (0)
+
+/**
+ * @brief 释放ticket锁并恢复中断
+ *
+ * @param lock  锁对象
+ * @param flags 中断状态保存变量
+ */
+#define ticket_lock_release_irqrestore(lock, flags) \
+    do                                              \
+    {                                               \
+        ticket_lock_release(lock);                  \
+        raw_local_irq_restore(flags);               \
+    } while (0)
+
+#ifdef CONFIG_TICKET_LOCK_STAT
+/**
+ * @brief 读取锁争用统计
+ *
+ * @details 统计字段非原子维护，读取值为近似快照，
+ *          用于定位锁热点足够
+ *
+ * @param lock 锁对象
+ * @param out  统计输出
+ */
+static inline void ticket_lock_stat_get(const struct ticket_lock *lock, struct ticket_lock_stat *out)
+{
+    *out = lock->stat;
+}
+#endif
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _TICKET_LOCK_H */
@@ -0,0 +1,135 @@
+/**
+ * @file    timer-wheel.h
+ * @brief   per-CPU层级定时器轮接口
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件定义per-CPU层级时间轮接口
+ *          - 三级时间轮，每级64槽，以tick为粒度管理大量软超时
+ *          - 同一tick到期的超时批量触发，硬件比较器只需跟踪
+ *            每核最近到期点，大幅减少TCFG CSR写入
+ *          - 定时器挂接在入队时所在核的轮上，到期回调在该核
+ *            定时器中断上下文执行
+ *
+ * @note MISRA-C:2012 合规
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _TIMER_WHEEL_H
+#define _TIMER_WHEEL_H
+
+/* ==================== 头文件包含 ==================== */
+#include <stdbool.h>
+#include <system/types.h>
+
+/* ==================== 宏定义 ==================== */
+
+/**
+ * @brief 每级槽位数的位宽（64槽）
+ */
+#define TWHEEL_SLOT_BITS 6U
+
+/**
+ * @brief 每级槽位数
+ */
+#define TWHEEL_SLOTS (1U << TWHEEL_SLOT_BITS)
+
+/**
+ * @brief 时间轮级数（覆盖64^3 = 262144个tick）
+ */
+#define TWHEEL_LEVELS 3U
+
+/* ==================== 数据结构 ==================== */
+
+/**
+ * @brief 时间轮定时器回调类型
+ *
+ * @details 在定时器所在核的定时器中断上下文执行，
+ *          须遵守中断上下文约束（不得睡眠）
+ */
+typedef void (*twheel_fn)(void *arg);
+
+/**
+ * @brief 时间轮定时器
+ *
+ * @details 调用方提供存储；pending非0表示已入队；
+ *          双向链接支持O(1)取消
+ */
+struct twheel_timer
+{
+    struct twheel_timer *next;   /**< @brief 槽内链表后继 */
+    struct twheel_timer **pprev; /**< @brief 指向前驱的next域 */
+    u64 expires;                 /**< @brief 绝对到期tick */
+    twheel_fn func;              /**< @brief 到期回调 */
+    void *arg;                   /**< @brief 回调参数 */
+    u32 cpu;                     /**< @brief 所属CPU */
+    volatile int pending;        /**< @brief 是否已入队 */
+};
+
+/* ==================== 外部函数声明 ==================== */
+
+/**
+ * @brief 初始化定时器对象
+ *
+ * @param timer 定时器对象（调用方提供存储）
+ * @param func  到期回调
+ * @param arg   回调参数
+ *
+ * @return 成功返回0，参数无效返回-EINVAL
+ */
+extern s32 twheel_timer_init(struct twheel_timer *timer, twheel_fn func, void *arg);
+
+/**
+ * @brief 把定时器加入本核时间轮
+ *
+ * @details 按相对tick数挂入对应级别的槽；已入队的定时器先取消
+ *          再按新到期时刻重新入队
+ *
+ * @param timer       定时器对象
+ * @param delta_ticks 相对当前的到期tick数（0按1处理）
+ *
+ * @return 成功返回0，参数无效返回-EINVAL
+ */
+extern s32 twheel_add(struct twheel_timer *timer, u64 delta_ticks);
+
+/**
+ * @brief 取消定时器
+ *
+ * @details 可跨核取消；定时器未入队或已触发时为空操作
+ *
+ * @param timer 定时器对象
+ *
+ * @return 取消成功返回true，定时器不在队列中返回false
+ */
+extern bool twheel_cancel(struct twheel_timer *timer);
+
+/**
+ * @brief 本核时间轮推进一个tick
+ *
+ * @details 定时器中断每tick调用：级联高层槽、批量触发本tick
+ *          到期的全部定时器；回调在锁外执行
+ */
+extern void twheel_tick(void);
+
+/**
+ * @brief 查询本核最近到期点
+ *
+ * @details 供tickless idle路径编程单次硬件比较器使用
+ *
+ * @return 距最近到期的tick数；轮上无定时器返回0
+ */
+extern u64 twheel_next_event_ticks(void);
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _TIMER_WHEEL_H */
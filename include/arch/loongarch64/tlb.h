@@ -107,6 +107,14 @@ extern void handle_tlb_modify(void);
  */
 extern void handle_tlb_refill(void);
 
+/**
+ * @brief TLB重填异常处理（带重填计数的剖析版本）
+ *
+ * @details 仅在CONFIG_TLB_REFILL_STAT构建下安装，每次重填
+ *          额外自增KS5指向的本核计数器
+ */
+extern void handle_tlb_refill_stat(void);
+
 /**
  * @brief TLB保护异常处理
  */
@@ -132,6 +140,28 @@ extern void handle_tlb_modify_ptw(void);
  */
 extern void tlb_init(void);
 
+/**
+ * @brief 激活地址空间的ASID
+ *
+ * @details ASID分配器采用代际回绕策略，地址空间切换只切ASID而不刷TLB
+ *
+ * @param mm 将要切入的地址空间
+ *
+ * @return 返回应写入LOONGARCH_CSR_ASID的硬件ASID值
+ */
+struct mm;
+extern unsigned long tlb_asid_activate(struct mm *mm);
+
+/**
+ * @brief 读取指定核的软件TLB重填次数
+ *
+ * @param cpu CPU编号
+ *
+ * @return 该核自启动以来的软件TLB重填次数；未启用
+ *         CONFIG_TLB_REFILL_STAT或硬件PTW重填时恒为0
+ */
+extern u64 tlb_refill_count_get(u32 cpu);
+
 /**
  * @brief 显示所有寄存器
  *
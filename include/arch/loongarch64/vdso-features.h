@@ -0,0 +1,109 @@
+/**
+ * @file    vdso-features.h
+ * @brief   用户只读共享页的CPU特性/平台信息布局
+ * @author  Intewell Team
+ * @date    2025-08-29
+ * @version 1.0
+ *
+ * @details 本文件定义与取时数据同页导出的CPU特性信息
+ *          - cpu_probe探测的特性位图（LOONGARCH_CPU_*）、
+ *            处理器ID、ISA级别、地址宽度、缓存行大小
+ *          - 特性区位于共享页内固定偏移，随vdso_time_map
+ *            一并以只读属性映射进每个进程
+ *          - 用户态运行时库据此做函数分派，零系统调用、
+ *            零cpucfg指令开销
+ *
+ * @note MISRA-C:2012 合规
+ * @note 本头文件同时被内核和用户库包含，只依赖stdint类型
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _VDSO_FEATURES_H
+#define _VDSO_FEATURES_H
+
+/* ==================== 头文件包含 ==================== */
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/* ==================== 宏定义 ==================== */
+
+/**
+ * @brief 特性区在共享页内的字节偏移
+ *
+ * @details 取时数据位于页首，特性区固定放在本偏移处；
+ *          用户库按 页基址 + 本偏移 定位特性区
+ */
+#define VDSO_FEATURES_OFFSET 256U
+
+/**
+ * @brief 特性区魔数（"VDF1"），用户库校验布局版本
+ */
+#define VDSO_FEATURES_MAGIC 0x31464456U
+
+/* ==================== 数据结构 ==================== */
+
+/**
+ * @brief 共享页CPU特性信息
+ *
+ * @details 内核启动时按boot CPU探测结果一次性填充，此后只读；
+ *          特性位图语义与内核cpuinfo_loongarch.options一致
+ */
+struct vdso_cpu_features
+{
+    uint32_t magic;        /**< @brief 魔数（VDSO_FEATURES_MAGIC） */
+    uint32_t prid;         /**< @brief 处理器ID（PRID） */
+    uint64_t options;      /**< @brief CPU特性位图（LOONGARCH_CPU_*） */
+    int32_t isa_level;     /**< @brief ISA级别 */
+    int32_t vabits;        /**< @brief 虚拟地址宽度（位） */
+    int32_t pabits;        /**< @brief 物理地址宽度（位） */
+    uint32_t fpu_vers;     /**< @brief FPU版本 */
+    uint32_t cache_line;   /**< @brief L1缓存行大小（字节） */
+    uint32_t page_size;    /**< @brief 基本页大小（字节） */
+    uint64_t timer_freq;   /**< @brief 稳定计数器频率（Hz） */
+};
+
+/* ==================== 内联函数 ==================== */
+
+/**
+ * @brief 用户态测试CPU特性位
+ *
+ * @details 特性区启动后只读，无需任何同步协议；
+ *          用户库在进程启动时据此一次性绑定优化实现
+ *
+ * @param vf  特性区指针（页基址 + VDSO_FEATURES_OFFSET）
+ * @param bit 特性位掩码（LOONGARCH_CPU_*）
+ *
+ * @return 支持返回1，不支持或布局不匹配返回0
+ */
+static inline int vdso_cpu_has(const struct vdso_cpu_features *vf, uint64_t bit)
+{
+    if (vf->magic != VDSO_FEATURES_MAGIC)
+    {
+        return 0;
+    }
+
+    return ((vf->options & bit) != 0U) ? 1 : 0;
+}
+
+/* ==================== 外部函数声明 ==================== */
+
+/**
+ * @brief 填充共享页特性区（内核侧）
+ *
+ * @details 从boot CPU的探测结果复制特性位图与平台参数；
+ *          由vdso_time_init在共享页初始化时调用，
+ *          须在cpu_probe完成之后执行
+ */
+extern void vdso_features_init(void);
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _VDSO_FEATURES_H */
@@ -0,0 +1,142 @@
+/**
+ * @file    vdso-time.h
+ * @brief   vDSO风格用户态快速取时接口
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件定义内核与用户态共享的取时数据页布局
+ *          - 内核把一个只读数据页映射进用户地址空间，页内含
+ *            mult/shift定点系数和epoch基准，由定时器中断维护
+ *          - 用户库用rdtime.d直读稳定计数器并按系数折算纳秒，
+ *            完成clock_gettime语义，全程不陷入内核
+ *          - 读侧用序列计数协议与内核写侧同步，无锁
+ *
+ * @note MISRA-C:2012 合规
+ * @note 本头文件同时被内核和用户库包含，只依赖stdint类型
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _VDSO_TIME_H
+#define _VDSO_TIME_H
+
+/* ==================== 头文件包含 ==================== */
+#include <stdint.h>
+
+/* ==================== 数据结构 ==================== */
+
+/**
+ * @brief 共享取时数据页内容
+ *
+ * @details 内核单写者（定时器中断），用户态多读者；
+ *          seq为偶表示内容一致，为奇表示内核正在更新
+ */
+struct vdso_time_data
+{
+    volatile uint32_t seq;   /**< @brief 序列计数（写侧更新期间为奇） */
+    uint32_t shift;          /**< @brief 折算右移位数 */
+    uint64_t mult;           /**< @brief 折算定点乘数 */
+    uint64_t epoch_count;    /**< @brief epoch基准计数器值 */
+    uint64_t epoch_ns;       /**< @brief epoch基准纳秒时刻 */
+    uint64_t freq;           /**< @brief 计数器频率（Hz） */
+};
+
+/* ==================== 内联函数 ==================== */
+
+/**
+ * @brief 用户态快速取纳秒时间戳
+ *
+ * @details 序列计数读协议：读seq（偶则有效）、读字段、再读seq
+ *          比对；不一致则重试。计数器直读rdtime.d，不陷入内核，
+ *          折算为ns = epoch_ns + ((count - epoch_count) * mult) >> shift
+ *
+ * @param vd 共享数据页指针（由用户库在映射后保存）
+ *
+ * @return 当前纳秒时间戳
+ *
+ * @note 纯用户态执行，单次调用通常两次缓存命中读加一次乘法
+ */
+static inline uint64_t vdso_clock_gettime_ns(const volatile struct vdso_time_data *vd)
+{
+    uint32_t seq;
+    uint64_t count;
+    uint64_t mult;
+    uint64_t epoch_count;
+    uint64_t epoch_ns;
+    uint32_t shift;
+
+    for (;;)
+    {
+        seq = vd->seq;
+        if ((seq & 1U) != 0U)
+        {
+            continue;  /* 内核正在更新，重读 */
+        }
+        __asm__ volatile("dbar 0" ::: "memory");
+
+        mult = vd->mult;
+        shift = vd->shift;
+        epoch_count = vd->epoch_count;
+        epoch_ns = vd->epoch_ns;
+
+        __asm__ volatile("dbar 0" ::: "memory");
+        if (vd->seq == seq)
+        {
+            break;
+        }
+    }
+
+    __asm__ volatile("rdtime.d %0, $zero" : "=r"(count));
+
+    return epoch_ns + (uint64_t)(((__uint128_t)(count - epoch_count) * mult) >> shift);
+}
+
+/* ==================== 外部函数声明 ==================== */
+
+/**
+ * @brief 地址空间类型（不完整声明，内核侧使用）
+ */
+struct mm;
+
+/**
+ * @brief 初始化共享取时数据页（内核侧）
+ *
+ * @details 按定时器频率填充mult/shift系数和epoch基准
+ *
+ * @return 成功返回0，定时器系数未就绪返回-EAGAIN
+ */
+extern int vdso_time_init(void);
+
+/**
+ * @brief 刷新共享数据页epoch基准（内核侧，定时器中断调用）
+ *
+ * @details 单写者：仅在定时器绑定核执行；序列计数写协议保证
+ *          用户读侧不会看到半更新的内容
+ */
+extern void vdso_time_update(void);
+
+/**
+ * @brief 把共享取时数据页映射进用户地址空间（内核侧）
+ *
+ * @details 以只读、用户可访问、不可执行属性把数据页映射到
+ *          指定用户mm的固定虚拟地址
+ *
+ * @param mm 目标用户地址空间
+ * @param va 目标虚拟地址（页对齐）
+ *
+ * @return 成功返回0，失败返回负错误码
+ */
+extern int vdso_time_map(struct mm *mm, uintptr_t va);
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _VDSO_TIME_H */
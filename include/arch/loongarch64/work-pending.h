@@ -0,0 +1,175 @@
+/**
+ * @file    work-pending.h
+ * @brief   返回用户态前待处理工作的快速标志
+ * @author  Intewell Team
+ * @date    2025-08-29
+ * @version 1.0
+ *
+ * @details 本文件定义每核缓存行对齐的待处理工作标志字
+ *          - 信号入队方/调度器/调试器置位，返回用户态路径
+ *            一次load取得位图，按位分发到信号投递、重调度、
+ *            调试寄存器恢复，标志为零时全部跳过
+ *          - 标志字独占一个缓存行，避免与其他per-CPU数据
+ *            产生伪共享
+ *          - 快速退出默认关闭：所有入队路径接通置位调用后
+ *            经arch_work_fast_exit_enable显式开启，未开启时
+ *            行为与原路径完全一致
+ *
+ * @note MISRA-C:2012 合规
+ * @note 性能关键路径：访问器全部内联
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#ifndef _WORK_PENDING_H
+#define _WORK_PENDING_H
+
+/* ==================== 头文件包含 ==================== */
+#include <current.h>
+#include <percpu.h>
+#include <system/types.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+/* ==================== 宏定义 ==================== */
+
+/**
+ * @brief 待处理工作位：有信号待投递
+ */
+#define ARCH_WORK_SIGPENDING (1U << 0)
+
+/**
+ * @brief 待处理工作位：需要重新调度
+ */
+#define ARCH_WORK_RESCHED (1U << 1)
+
+/**
+ * @brief 待处理工作位：需要恢复硬件调试寄存器
+ *
+ * @note 调试状态安装时广播置位后保持常驻（粘滞位），返回
+ *       路径仍以进程ptrace标志做最终判定；无调试器的系统
+ *       该位恒为0，返回路径完全跳过调试分支
+ */
+#define ARCH_WORK_DEBUG_RESTORE (1U << 2)
+
+/**
+ * @brief 全部待处理工作位（快速退出未开启时的保守返回值）
+ */
+#define ARCH_WORK_ALL_MASK (ARCH_WORK_SIGPENDING | ARCH_WORK_RESCHED | ARCH_WORK_DEBUG_RESTORE)
+
+/* ==================== 数据结构 ==================== */
+
+/**
+ * @brief 每核待处理工作标志（独占缓存行，避免伪共享）
+ */
+struct arch_work_flags
+{
+    volatile u32 flags;                 /**< @brief 工作位图 */
+    u8 pad[64U - sizeof(u32)];          /**< @brief 填充到缓存行 */
+} __attribute__((aligned(64)));
+
+/* ==================== 外部变量 ==================== */
+DECLARE_PER_CPU(struct arch_work_flags, arch_work_pending);
+
+extern volatile int g_arch_work_fast_exit;
+
+/* ==================== 内联函数 ==================== */
+
+/**
+ * @brief 置位本核待处理工作标志
+ *
+ * @param bits 工作位（ARCH_WORK_*）
+ *
+ * @note 性能关键路径：一条load加一条store，调用方保证关抢占
+ */
+static inline void arch_work_pending_set(u32 bits)
+{
+    struct arch_work_flags *wf = this_cpu_ptr(arch_work_pending);
+
+    wf->flags |= bits;
+}
+
+/**
+ * @brief 置位指定核的待处理工作标志
+ *
+ * @details 跨核信号入队方使用：先置位再发IPI，目标核返回
+ *          用户态时即可见
+ *
+ * @param cpu  目标CPU编号
+ * @param bits 工作位（ARCH_WORK_*）
+ */
+static inline void arch_work_pending_set_cpu(u32 cpu, u32 bits)
+{
+    per_cpu(arch_work_pending, cpu).flags |= bits;
+}
+
+/**
+ * @brief 置位所有核的待处理工作标志
+ *
+ * @details 调试状态安装等冷路径使用：被跟踪任务可能迁移到
+ *          任意核，广播置位保证各核返回路径都能看到
+ *
+ * @param bits 工作位（ARCH_WORK_*）
+ */
+static inline void arch_work_pending_set_all(u32 bits)
+{
+    u32 cpu;
+
+    for (cpu = 0U; cpu < (u32)CONFIG_MAX_CPUS; cpu++)
+    {
+        per_cpu(arch_work_pending, cpu).flags |= bits;
+    }
+}
+
+/**
+ * @brief 清除本核待处理工作标志
+ *
+ * @param bits 工作位（ARCH_WORK_*）
+ */
+static inline void arch_work_pending_clear(u32 bits)
+{
+    struct arch_work_flags *wf = this_cpu_ptr(arch_work_pending);
+
+    wf->flags &= ~bits;
+}
+
+/**
+ * @brief 测试本核待处理工作位图
+ *
+ * @details 快速退出未开启时恒返回全位图（各返回路径保守
+ *          执行全部工作项，与原路径一致）；开启后一次load
+ *          取得位图，调用方按位分发到对应处理
+ *
+ * @return 待处理工作位图（ARCH_WORK_*按位组合），无工作返回0
+ *
+ * @note 性能关键路径
+ */
+static inline u32 arch_work_pending_test(void)
+{
+    if (g_arch_work_fast_exit == 0)
+    {
+        return ARCH_WORK_ALL_MASK;
+    }
+
+    return this_cpu_ptr(arch_work_pending)->flags;
+}
+
+/* ==================== 外部函数声明 ==================== */
+
+/**
+ * @brief 开启返回用户态快速退出
+ *
+ * @details 仅当所有信号入队/调度请求路径已接通
+ *          arch_work_pending_set调用后才可开启
+ */
+extern void arch_work_fast_exit_enable(void);
+
+/* ==================== C++兼容性 ==================== */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _WORK_PENDING_H */
@@ -73,6 +73,17 @@ extern "C"
 #define PT_SINGLESTEP 0x80000000U /**< @brief 单步执行 */
 /** @} */
 
+/**
+ * @defgroup PtraceMemv 批量内存传输扩展请求
+ * @brief 非标准扩展：单次 ptrace 调用搬运任意大小的目标进程内存，
+ *        替代 PEEKDATA/POKEDATA 的逐字往返
+ * @{
+ */
+#define PTRACE_READ_MEMV 0x5001  /**< @brief 批量读取目标进程内存 */
+#define PTRACE_WRITE_MEMV 0x5002 /**< @brief 批量写入目标进程内存 */
+#define PTRACE_MEMV_MAX 64U      /**< @brief 单次请求的最大分段数 */
+/** @} */
+
 /*************************** 数据结构 ****************************/
 /**
  * @brief 进程控制块结构
@@ -101,6 +112,19 @@ struct process_control_block
     } debug_state; /**< @brief 调试状态 */
 };
 
+/**
+ * @brief 批量内存传输描述项
+ *
+ * @details PTRACE_READ_MEMV/PTRACE_WRITE_MEMV 请求的单个分段描述：
+ *          addr 参数传入本结构数组，data 参数传入数组元素个数
+ */
+struct ptrace_memv
+{
+    void *pm_remote; /**< @brief 目标进程虚拟地址 */
+    void *pm_local;  /**< @brief 调用方缓冲区地址 */
+    size_t pm_len;   /**< @brief 传输字节数 */
+};
+
 /*************************** 类型定义 ****************************/
 /**
  * @brief 进程控制块指针类型
@@ -0,0 +1,113 @@
+/**
+ * @file    alternative.c
+ * @brief   启动期指令热补丁框架实现
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件实现alternatives风格的启动期指令修补
+ *          - 遍历链接脚本收集的.altinstructions记录表，按
+ *            cpu_data[0]的特性位决定是否用候选序列覆盖原始序列
+ *          - 以4字节指令字为单位逐字覆盖，候选序列短于原始序列
+ *            时用NOP补齐剩余指令槽
+ *          - 修补区间经cache_text_batch批量收集，全部覆盖完成后
+ *            只执行一次指令屏障
+ *
+ * @note MISRA-C:2012 合规
+ * @warning 仅在启动期主核单核环境调用，修补期间不得有其他核
+ *          取指被修补的代码
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#define KLOG_TAG "alternative"
+
+/*************************** 头文件包含 ****************************/
+#include <alternative.h>
+#include <cache-text.h>
+#include <cpu-features.h>
+#include <klog.h>
+#include <stddef.h>
+
+/*************************** 宏定义 ****************************/
+/* LoongArch64指令定长4字节 */
+#define ALT_INSN_SIZE 4U
+
+/*************************** 外部声明 ****************************/
+/* 链接脚本提供的修补记录表边界 */
+extern struct alt_instr __alt_instructions[];
+extern struct alt_instr __alt_instructions_end[];
+
+/*************************** 函数实现 ****************************/
+
+/**
+ * @brief 应用单条修补记录
+ *
+ * @details 逐指令字把候选序列覆盖到原始序列位置，剩余指令槽
+ *          写入NOP；调用方保证记录已通过特性检查
+ *
+ * @param alt   修补记录
+ * @param batch 批量缓存同步上下文
+ */
+static void alt_patch_one(const struct alt_instr *alt, struct cache_text_batch *batch)
+{
+    u32 *instr = (u32 *)((size_t)&alt->instr_offset + (size_t)alt->instr_offset);
+    const u32 *replace = (const u32 *)((size_t)&alt->replace_offset + (size_t)alt->replace_offset);
+    u32 total = (u32)alt->instrlen / ALT_INSN_SIZE;
+    u32 copy = (u32)alt->replacementlen / ALT_INSN_SIZE;
+    u32 i;
+
+    for (i = 0U; i < copy; i++)
+    {
+        instr[i] = replace[i];
+    }
+
+    /* 候选序列较短时补齐NOP，保持原始槽位长度不变 */
+    for (i = copy; i < total; i++)
+    {
+        instr[i] = ALT_NOP_INSN;
+    }
+
+    cache_text_batch_add(batch, (size_t)instr, (size_t)alt->instrlen);
+}
+
+/**
+ * @brief 应用全部指令热补丁
+ *
+ * @details 遍历.altinstructions记录表，命中当前CPU特性位的记录
+ *          原地覆盖；候选序列长于原始槽位的记录视为构建错误，
+ *          跳过并告警
+ *
+ * @note 必须在cpu_probe()之后、从核释放之前由主核调用一次
+ */
+void apply_alternatives(void)
+{
+    const struct alt_instr *alt;
+    struct cache_text_batch batch;
+    u32 applied = 0U;
+
+    cache_text_batch_init(&batch);
+
+    for (alt = __alt_instructions; alt < __alt_instructions_end; alt++)
+    {
+        if (alt->replacementlen > alt->instrlen)
+        {
+            KLOG_E("alt entry feature=%u: replacement %u > slot %u, skipped",
+                   (u32)alt->feature, (u32)alt->replacementlen, (u32)alt->instrlen);
+            continue;
+        }
+
+        if (cpu_has(alt->feature) == 0U)
+        {
+            continue;
+        }
+
+        alt_patch_one(alt, &batch);
+        applied++;
+    }
+
+    /* 统一提交缓存同步，指令屏障只执行一次 */
+    cache_text_batch_flush(&batch);
+
+    KLOG_I("alternatives: %u entries applied", applied);
+}
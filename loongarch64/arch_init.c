@@ -16,10 +16,16 @@
  */
 /*************************** 头文件包含 ****************************/
 #include <adrspace.h>
+#include <alternative.h>
+#include <arch/loongarch64/backtrace.h>
+#include <boot-trace.h>
 #include <cpu.h>
+#include <crashdump.h>
+#include <exc-stack.h>
 #include <exception.h>
 #include <mmu.h>
 #include <percpu.h>
+#include <smp-boot.h>
 #include <stdint.h>
 #include <system/const.h>
 #include <system/types.h>
@@ -102,10 +108,26 @@ void early_mmu_init(void)
  */
 void bp_arch_init(void)
 {
+    /* 归入crt1.S汇编阶段打点并记录C初始化起点 */
+    boot_trace_asm_import();
+    boot_trace_mark("bp_arch_init");
     cpu_probe();
+    boot_trace_mark("cpu_probe");
+    /* 特性位已就绪，单核窗口内完成指令热补丁 */
+    apply_alternatives();
+    boot_trace_mark("apply_alternatives");
     exception_init();
+    exc_stack_init();
+    boot_trace_mark("exception_init");
     early_mmu_init();
+    boot_trace_mark("early_mmu_init");
     trap_init();
+    boot_trace_mark("trap_init");
+    backtrace_symtab_init();
+    boot_trace_mark("backtrace_symtab_init");
+    /* 校验上次崩溃记录并建立保留区访问基址 */
+    crashdump_init();
+    boot_trace_mark("crashdump_init");
 }
 
 /**
@@ -124,7 +146,11 @@ void bp_arch_init(void)
  */
 void ap_arch_init(void)
 {
+    /* 以下均为本核私有初始化，各从核可并行执行 */
     cpu_probe();
     exception_init();
+    exc_stack_init();
     loongson_init_secondary();
+    /* 本地初始化完成，向主核汇合 */
+    smp_boot_arrive();
 }
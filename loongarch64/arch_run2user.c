@@ -80,9 +80,11 @@ __noreturn void arch_run2user(void)
      *   - pcb->args: 传递给用户程序的参数（将被清零，实际参数通过 auxv 在栈上传递）
      *   - pcb->userStack: 用户栈指针
      *   - pcb->entry: 用户程序入口地址
-     *   - 0x0F: PRMD 寄存器值，设置 PPLV=3 (用户模式、中断使能、指令和数据监视点使能)
+     *   - CSR_PRMD_USER_INIT: PRMD 编译期常量，PPLV=3 (用户模式、中断使能、指令和数据监视点使能)，
+     *     该值架构上不随进程变化，用常量即等价于在PCB中缓存预计算结果
      */
-    return2user((uintptr_t)pcb->args, (uintptr_t)pcb->userStack, (uintptr_t)pcb->entry, 0x0FU);
+    return2user((uintptr_t)pcb->args, (uintptr_t)pcb->userStack, (uintptr_t)pcb->entry,
+                (uintptr_t)CSR_PRMD_USER_INIT);
 
     /*
      * 永远不会执行到这里
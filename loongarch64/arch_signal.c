@@ -26,14 +26,17 @@
 #include <cpu-info.h>
 #include <errno.h>
 #include <fpu.h>
+#include <memfast.h>
 #include <process_signal.h>
 #include <sigcontext.h>
 #include <signal.h>
+#include <stddef.h>
 #include <syscall.h>
 #include <ttos.h>
 #include <ttosProcess.h>
 #include <uaccess.h>
 #include <util.h>
+#include <work-pending.h>
 #undef KLOG_TAG
 #define KLOG_TAG "arch_signal"
 #include <klog.h>
@@ -69,6 +72,7 @@ struct extctx_layout
     struct _ctx_layout lsx;
     struct _ctx_layout lasx;
     struct _ctx_layout lbt;
+    struct _ctx_layout skip;
     struct _ctx_layout end;
 };
 
@@ -77,6 +81,17 @@ struct extctx_layout
 /*************************** 前向声明 ****************************/
 
 /*************************** 模块变量 ****************************/
+/* 布局模板基址对齐：各扩展节对齐要求（最大为LASX的32字节）的公倍数 */
+#define EXTCTX_TMPL_ALIGN 32U
+
+/* 模板构建用的伪基址（按EXTCTX_TMPL_ALIGN对齐即可，仅用于换算偏移） */
+#define EXTCTX_TMPL_BASE (1UL << 32)
+
+/* 按SC_USED_FP分组缓存的extcontext布局模板（addr字段存相对基址的偏移）。
+ * 布局只取决于标志位和常量cpu_has_*，与具体进程无关，
+ * 进程生命周期内重复投递信号时热路径无需重算各节大小与对齐 */
+static struct extctx_layout s_extctx_tmpl[2];
+static bool s_extctx_tmpl_valid[2];
 
 /*************************** 函数实现 ****************************/
 
@@ -122,20 +137,25 @@ static void __user *get_ctx_through_ctxinfo(struct sctx_info *info)
 static int copy_lsx_to_sigcontext(struct lsx_context __user *ctx)
 {
     int i;
-    int err = 0;
-    uint64_t __user *regs = (uint64_t *)&ctx->regs;
-    uint64_t __user *fcc = &ctx->fcc;
-    uint32_t __user *fcsr = &ctx->fcsr;
+    struct lsx_context kctx;
     pcb_t pcb = ttosProcessSelf();
+
+    /* 先在内核栈上聚齐完整镜像（TCB中fpr步长32字节，用户布局16字节，需收拢） */
     for (i = 0; i < 32; i++)
     {
-        err |= __put_user(pcb->taskControlId->switchContext.fpu.fpr[i].val64[0], &regs[2 * i]);
-        err |= __put_user(pcb->taskControlId->switchContext.fpu.fpr[i].val64[1], &regs[2 * i + 1]);
+        kctx.regs[2 * i] = pcb->taskControlId->switchContext.fpu.fpr[i].val64[0];
+        kctx.regs[2 * i + 1] = pcb->taskControlId->switchContext.fpu.fpr[i].val64[1];
     }
-    err |= __put_user(pcb->taskControlId->switchContext.fpu.fcc, fcc);
-    err |= __put_user(pcb->taskControlId->switchContext.fpu.fcsr, fcsr);
+    kctx.fcc = pcb->taskControlId->switchContext.fpu.fcc;
+    kctx.fcsr = pcb->taskControlId->switchContext.fpu.fcsr;
 
-    return err;
+    /* 单次批量写出，替代66次__put_user */
+    if (arch_copy_to_user(ctx, &kctx, sizeof(kctx)) != 0UL)
+    {
+        return -EFAULT;
+    }
+
+    return 0;
 }
 
 /**
@@ -150,23 +170,24 @@ static int copy_lsx_to_sigcontext(struct lsx_context __user *ctx)
 static int copy_lsx_from_sigcontext(struct lsx_context __user *ctx)
 {
     int i;
-    int err = 0;
-    u64 fpr_val;
-    uint64_t __user *regs = (uint64_t *)&ctx->regs;
-    uint64_t __user *fcc = &ctx->fcc;
-    uint32_t __user *fcsr = &ctx->fcsr;
+    struct lsx_context kctx;
     pcb_t pcb = ttosProcessSelf();
+
+    /* 单次批量读入内核栈镜像，替代66次__get_user */
+    if (arch_copy_from_user(&kctx, ctx, sizeof(kctx)) != 0UL)
+    {
+        return -EFAULT;
+    }
+
     for (i = 0; i < 32; i++)
     {
-        err |= __get_user(fpr_val, &regs[2 * i]);
-        pcb->taskControlId->switchContext.fpu.fpr[i].val64[0] = fpr_val;
-        err |= __get_user(fpr_val, &regs[2 * i + 1]);
-        pcb->taskControlId->switchContext.fpu.fpr[i].val64[1] = fpr_val;
+        pcb->taskControlId->switchContext.fpu.fpr[i].val64[0] = kctx.regs[2 * i];
+        pcb->taskControlId->switchContext.fpu.fpr[i].val64[1] = kctx.regs[2 * i + 1];
     }
-    err |= __get_user(pcb->taskControlId->switchContext.fpu.fcc, fcc);
-    err |= __get_user(pcb->taskControlId->switchContext.fpu.fcsr, fcsr);
+    pcb->taskControlId->switchContext.fpu.fcc = kctx.fcc;
+    pcb->taskControlId->switchContext.fpu.fcsr = kctx.fcsr;
 
-    return err;
+    return 0;
 }
 /**
  * @brief 复制 LASX 上下文到信号上下文
@@ -179,23 +200,21 @@ static int copy_lsx_from_sigcontext(struct lsx_context __user *ctx)
  */
 static int copy_lasx_to_sigcontext(struct lasx_context __user *ctx)
 {
-    int i;
-    int err = 0;
-    uint64_t __user *regs = (uint64_t *)&ctx->regs;
-    uint64_t __user *fcc = &ctx->fcc;
-    uint32_t __user *fcsr = &ctx->fcsr;
+    struct lasx_context kctx;
     pcb_t pcb = ttosProcessSelf();
-    for (i = 0; i < 32; i++)
+
+    /* 用户布局regs[4*i+j]与TCB中fpr数组逐字节一致，整块收拢 */
+    arch_memcpy_fast(kctx.regs, &pcb->taskControlId->switchContext.fpu.fpr[0], sizeof(kctx.regs));
+    kctx.fcc = pcb->taskControlId->switchContext.fpu.fcc;
+    kctx.fcsr = pcb->taskControlId->switchContext.fpu.fcsr;
+
+    /* 单次批量写出，替代130次__put_user */
+    if (arch_copy_to_user(ctx, &kctx, sizeof(kctx)) != 0UL)
     {
-        err |= __put_user(pcb->taskControlId->switchContext.fpu.fpr[i].val64[0], &regs[4 * i]);
-        err |= __put_user(pcb->taskControlId->switchContext.fpu.fpr[i].val64[1], &regs[4 * i + 1]);
-        err |= __put_user(pcb->taskControlId->switchContext.fpu.fpr[i].val64[2], &regs[4 * i + 2]);
-        err |= __put_user(pcb->taskControlId->switchContext.fpu.fpr[i].val64[3], &regs[4 * i + 3]);
+        return -EFAULT;
     }
-    err |= __put_user(pcb->taskControlId->switchContext.fpu.fcc, fcc);
-    err |= __put_user(pcb->taskControlId->switchContext.fpu.fcsr, fcsr);
 
-    return err;
+    return 0;
 }
 /**
  * @brief 从信号上下文恢复 LASX 上下文
@@ -208,28 +227,21 @@ static int copy_lasx_to_sigcontext(struct lasx_context __user *ctx)
  */
 static int copy_lasx_from_sigcontext(struct lasx_context __user *ctx)
 {
-    int i;
-    int err = 0;
-    u64 fpr_val;
-    uint64_t __user *regs = (uint64_t *)&ctx->regs;
-    uint64_t __user *fcc = &ctx->fcc;
-    uint32_t __user *fcsr = &ctx->fcsr;
+    struct lasx_context kctx;
     pcb_t pcb = ttosProcessSelf();
-    for (i = 0; i < 32; i++)
+
+    /* 单次批量读入内核栈镜像，替代130次__get_user */
+    if (arch_copy_from_user(&kctx, ctx, sizeof(kctx)) != 0UL)
     {
-        err |= __get_user(fpr_val, &regs[4 * i]);
-        pcb->taskControlId->switchContext.fpu.fpr[i].val64[0] = fpr_val;
-        err |= __get_user(fpr_val, &regs[4 * i + 1]);
-        pcb->taskControlId->switchContext.fpu.fpr[i].val64[1] = fpr_val;
-        err |= __get_user(fpr_val, &regs[4 * i + 2]);
-        pcb->taskControlId->switchContext.fpu.fpr[i].val64[2] = fpr_val;
-        err |= __get_user(fpr_val, &regs[4 * i + 3]);
-        pcb->taskControlId->switchContext.fpu.fpr[i].val64[3] = fpr_val;
+        return -EFAULT;
     }
-    err |= __get_user(pcb->taskControlId->switchContext.fpu.fcc, fcc);
-    err |= __get_user(pcb->taskControlId->switchContext.fpu.fcsr, fcsr);
 
-    return err;
+    /* 用户布局regs[4*i+j]与TCB中fpr数组逐字节一致，整块散开 */
+    arch_memcpy_fast(&pcb->taskControlId->switchContext.fpu.fpr[0], kctx.regs, sizeof(kctx.regs));
+    pcb->taskControlId->switchContext.fpu.fcc = kctx.fcc;
+    pcb->taskControlId->switchContext.fpu.fcsr = kctx.fcsr;
+
+    return 0;
 }
 #ifdef CONFIG_CPU_HAS_LBT
 /**
@@ -509,19 +521,24 @@ static int restore_hw_ftop_context(struct lbt_context __user *ctx)
 static int copy_fpu_to_sigcontext(struct fpu_context __user *ctx)
 {
     int i;
-    int err = 0;
-    uint64_t __user *regs = (uint64_t *)&ctx->regs;
-    uint64_t __user *fcc = &ctx->fcc;
-    uint32_t __user *fcsr = &ctx->fcsr;
+    struct fpu_context kctx;
     pcb_t pcb = ttosProcessSelf();
+
+    /* 先在内核栈上聚齐完整镜像（TCB中fpr步长32字节，用户布局8字节，需收拢） */
     for (i = 0; i < 32; i++)
     {
-        err |= __put_user(pcb->taskControlId->switchContext.fpu.fpr[i].val64[0], &regs[i]);
+        kctx.regs[i] = pcb->taskControlId->switchContext.fpu.fpr[i].val64[0];
     }
-    err |= __put_user(pcb->taskControlId->switchContext.fpu.fcc, fcc);
-    err |= __put_user(pcb->taskControlId->switchContext.fpu.fcsr, fcsr);
+    kctx.fcc = pcb->taskControlId->switchContext.fpu.fcc;
+    kctx.fcsr = pcb->taskControlId->switchContext.fpu.fcsr;
 
-    return err;
+    /* 单次批量写出，替代34次__put_user */
+    if (arch_copy_to_user(ctx, &kctx, sizeof(kctx)) != 0UL)
+    {
+        return -EFAULT;
+    }
+
+    return 0;
 }
 /**
  * @brief 从信号上下文恢复 FPU 上下文
@@ -536,21 +553,23 @@ static int copy_fpu_to_sigcontext(struct fpu_context __user *ctx)
 static int copy_fpu_from_sigcontext(struct fpu_context __user *ctx)
 {
     int i;
-    int err = 0;
-    u64 fpr_val;
-    uint64_t __user *regs = (uint64_t *)&ctx->regs;
-    uint64_t __user *fcc = &ctx->fcc;
-    uint32_t __user *fcsr = &ctx->fcsr;
+    struct fpu_context kctx;
     pcb_t pcb = ttosProcessSelf();
+
+    /* 单次批量读入内核栈镜像，替代34次__get_user */
+    if (arch_copy_from_user(&kctx, ctx, sizeof(kctx)) != 0UL)
+    {
+        return -EFAULT;
+    }
+
     for (i = 0; i < 32; i++)
     {
-        err |= __get_user(fpr_val, &regs[i]);
-        pcb->taskControlId->switchContext.fpu.fpr[i].val64[0] = fpr_val;
+        pcb->taskControlId->switchContext.fpu.fpr[i].val64[0] = kctx.regs[i];
     }
-    err |= __get_user(pcb->taskControlId->switchContext.fpu.fcc, fcc);
-    err |= __get_user(pcb->taskControlId->switchContext.fpu.fcsr, fcsr);
+    pcb->taskControlId->switchContext.fpu.fcc = kctx.fcc;
+    pcb->taskControlId->switchContext.fpu.fcsr = kctx.fcsr;
 
-    return err;
+    return 0;
 }
 /**
  * @brief 检查并处理 FPU CSR 异常标志
@@ -873,25 +892,45 @@ static int setup_sigcontext(struct arch_context *regs, struct sigcontext __user
 {
     int i, err = 0;
     struct sctx_info __user *info;
-    err |= __put_user(regs->csr_era, &sc->sc_pc);
-    err |= __put_user(extctx->flags, &sc->sc_flags);
-    err |= __put_user(0, &sc->sc_regs[0]);
+    struct sctx_info kinfo;
+    struct sigcontext ksc;
+
+    /* 先在内核栈上构建pc/flags/通用寄存器镜像，单次批量写出替代35次__put_user */
+    memset(&ksc, 0, offsetof(struct sigcontext, sc_extcontext));
+    ksc.sc_pc = regs->csr_era;
+    ksc.sc_flags = extctx->flags;
+    ksc.sc_regs[0] = 0;
     for (i = 1; i < 32; i++)
-        err |= __put_user(regs->regs[i], &sc->sc_regs[i]);
+        ksc.sc_regs[i] = regs->regs[i];
+    if (arch_copy_to_user(sc, &ksc, offsetof(struct sigcontext, sc_extcontext)) != 0UL)
+        err |= -EFAULT;
     if (extctx->lasx.addr)
         err |= protected_save_lasx_context(extctx);
     else if (extctx->lsx.addr)
         err |= protected_save_lsx_context(extctx);
     else if (extctx->fpu.addr)
         err |= protected_save_fpu_context(extctx);
+    else if (extctx->skip.addr)
+    {
+        /* 扩展状态不脏：只写占位节头，sigreturn据此跳过恢复 */
+        info = (struct sctx_info *)extctx->skip.addr;
+        kinfo.magic = SKIP_CTX_MAGIC;
+        kinfo.size = extctx->skip.size;
+        kinfo.padding = 0;
+        if (arch_copy_to_user(info, &kinfo, sizeof(kinfo)) != 0UL)
+            err |= -EFAULT;
+    }
 #ifdef CONFIG_CPU_HAS_LBT
     if (extctx->lbt.addr)
         err |= protected_save_lbt_context(extctx);
 #endif
-    /* Set the "end" magic */
+    /* Set the "end" magic（节头整体批量写出） */
     info = (struct sctx_info *)extctx->end.addr;
-    err |= __put_user(0, &info->magic);
-    err |= __put_user(0, &info->size);
+    kinfo.magic = 0;
+    kinfo.size = 0;
+    kinfo.padding = 0;
+    if (arch_copy_to_user(info, &kinfo, sizeof(kinfo)) != 0UL)
+        err |= -EFAULT;
 
     return err;
 }
@@ -941,6 +980,12 @@ static int parse_extcontext(struct sigcontext __user *sc, struct extctx_layout *
                 goto invalid;
             extctx->lbt.addr = info;
             break;
+        case SKIP_CTX_MAGIC:
+            /* 占位节：投递时扩展状态未保存，恢复时对应跳过 */
+            if (size < sizeof(struct sctx_info))
+                goto invalid;
+            extctx->skip.addr = info;
+            break;
         default:
             goto invalid;
         }
@@ -967,14 +1012,28 @@ static int restore_sigcontext(struct arch_context *regs, struct sigcontext __use
 {
     int i, err = 0;
     struct extctx_layout extctx;
+    struct sigcontext ksc;
     memset(&extctx, 0, sizeof(struct extctx_layout));
-    err = __get_user(extctx.flags, &sc->sc_flags);
-    if (err)
+    /* 单次批量读入pc/flags/通用寄存器前缀，替代34次__get_user */
+    if (arch_copy_from_user(&ksc, sc, offsetof(struct sigcontext, sc_extcontext)) != 0UL)
+    {
+        err = -EFAULT;
         goto bad;
-    err |= __get_user(regs->csr_era, &sc->sc_pc);
+    }
+    extctx.flags = ksc.sc_flags;
+    regs->csr_era = ksc.sc_pc;
     for (i = 1; i < 32; i++)
-        err |= __get_user(regs->regs[i], &sc->sc_regs[i]);
-#endif
+        regs->regs[i] = ksc.sc_regs[i];
+    err |= parse_extcontext(sc, &extctx);
+    if (err)
+        goto bad;
+    /* 占位节（extctx.skip）：投递时扩展状态未落盘，此处跳过恢复 */
+    if (extctx.lasx.addr)
+        err |= protected_restore_lasx_context(&extctx);
+    else if (extctx.lsx.addr)
+        err |= protected_restore_lsx_context(&extctx);
+    else if (extctx.fpu.addr)
+        err |= protected_restore_fpu_context(&extctx);
 bad:
 
     return err;
@@ -983,54 +1042,134 @@ bad:
 /**
  * @brief 处理信号标志
  *
- * @details 生成信号上下文标志位
+ * @details 生成信号上下文标志位，带扩展状态脏跟踪：
+ *          配合惰性EUEN机制，切入时使能位被关断，首次使用才置位，
+ *          因此当前EUEN的使能位即"自上次保存以来单元被写过"；
+ *          切出时保存的EUEN记录任务是否持有驻留状态。
+ *          两者均为零说明任务没有任何扩展状态，信号帧只写占位节
  *
  * @return 信号上下文标志位
  */
 static unsigned int handle_flags(void)
 {
     unsigned int flags = 0;
+    unsigned int euen = csr_read32(LOONGARCH_CSR_EUEN);
+
+    /* 驻留状态：任务上次切出时已使能的单元（状态保存在TCB中） */
+    euen |= (unsigned int)ttosProcessSelf()->taskControlId->switchContext.csr_euen;
+
+    if ((euen & (CSR_EUEN_FPEN | CSR_EUEN_LSXEN | CSR_EUEN_LASXEN)) != 0U)
+    {
+        flags |= SC_USED_FP;
+    }
 
     return flags;
 }
 
 /**
- * @brief 设置扩展上下文
+ * @brief 构建扩展上下文布局模板
  *
- * @details 在用户空间栈上设置扩展上下文布局
+ * @details 从伪基址出发完整跑一遍各节的大小与对齐计算，
+ *          再把各节地址换算为相对基址的向下偏移存入模板；
+ *          只要基址按EXTCTX_TMPL_ALIGN对齐，偏移即普适
  *
- * @param extctx 扩展上下文布局指针
- * @param sp 当前栈指针
- *
- * @return 新的栈指针地址
+ * @param tmpl 模板指针
+ * @param flags 信号上下文标志位（决定落盘完整状态还是占位节）
  */
-static unsigned long setup_extcontext(struct extctx_layout *extctx, unsigned long sp)
+static void extctx_build_template(struct extctx_layout *tmpl, unsigned int flags)
 {
-    unsigned long new_sp = sp;
-    memset(extctx, 0, sizeof(struct extctx_layout));
-    extctx->flags = handle_flags();
+    unsigned long new_sp = EXTCTX_TMPL_BASE;
+    memset(tmpl, 0, sizeof(struct extctx_layout));
+    tmpl->flags = flags;
     /* Grow down, alloc "end" context info first. */
     new_sp -= sizeof(struct sctx_info);
-    extctx->end.addr = (void *)new_sp;
-    extctx->end.size = (unsigned int)sizeof(struct sctx_info);
-    extctx->size += extctx->end.size;
-    if (extctx->flags & SC_USED_FP)
+    tmpl->end.addr = (void *)new_sp;
+    tmpl->end.size = (unsigned int)sizeof(struct sctx_info);
+    tmpl->size += tmpl->end.size;
+    if (flags & SC_USED_FP)
     {
         if (cpu_has_lasx)
-            new_sp = extframe_alloc(extctx, &extctx->lasx, sizeof(struct lasx_context), LASX_CTX_ALIGN, new_sp);
+            new_sp = extframe_alloc(tmpl, &tmpl->lasx, sizeof(struct lasx_context), LASX_CTX_ALIGN, new_sp);
         else if (cpu_has_lsx)
-            new_sp = extframe_alloc(extctx, &extctx->lsx, sizeof(struct lsx_context), LSX_CTX_ALIGN, new_sp);
+            new_sp = extframe_alloc(tmpl, &tmpl->lsx, sizeof(struct lsx_context), LSX_CTX_ALIGN, new_sp);
         else if (cpu_has_fpu)
-            new_sp = extframe_alloc(extctx, &extctx->fpu, sizeof(struct fpu_context), FPU_CTX_ALIGN, new_sp);
+            new_sp = extframe_alloc(tmpl, &tmpl->fpu, sizeof(struct fpu_context), FPU_CTX_ALIGN, new_sp);
+    }
+    else if (cpu_has_fpu)
+    {
+        /* 扩展状态不脏：只写轻量占位节，省去整段向量状态的落盘 */
+        new_sp = extframe_alloc(tmpl, &tmpl->skip, 0, SKIP_CTX_ALIGN, new_sp);
     }
 #ifdef CONFIG_CPU_HAS_LBT
     if (cpu_has_lbt)
     {
-        new_sp = extframe_alloc(extctx, &extctx->lbt, sizeof(struct lbt_context), LBT_CTX_ALIGN, new_sp);
+        new_sp = extframe_alloc(tmpl, &tmpl->lbt, sizeof(struct lbt_context), LBT_CTX_ALIGN, new_sp);
     }
 #endif
 
-    return new_sp;
+    /* 地址换算为相对伪基址的向下偏移 */
+    if (tmpl->end.addr)
+        tmpl->end.addr = (void *)(EXTCTX_TMPL_BASE - (unsigned long)tmpl->end.addr);
+    if (tmpl->lasx.addr)
+        tmpl->lasx.addr = (void *)(EXTCTX_TMPL_BASE - (unsigned long)tmpl->lasx.addr);
+    if (tmpl->lsx.addr)
+        tmpl->lsx.addr = (void *)(EXTCTX_TMPL_BASE - (unsigned long)tmpl->lsx.addr);
+    if (tmpl->fpu.addr)
+        tmpl->fpu.addr = (void *)(EXTCTX_TMPL_BASE - (unsigned long)tmpl->fpu.addr);
+    if (tmpl->skip.addr)
+        tmpl->skip.addr = (void *)(EXTCTX_TMPL_BASE - (unsigned long)tmpl->skip.addr);
+#ifdef CONFIG_CPU_HAS_LBT
+    if (tmpl->lbt.addr)
+        tmpl->lbt.addr = (void *)(EXTCTX_TMPL_BASE - (unsigned long)tmpl->lbt.addr);
+#endif
+}
+
+/**
+ * @brief 设置扩展上下文
+ *
+ * @details 在用户空间栈上设置扩展上下文布局。
+ *          布局模板按SC_USED_FP分组缓存，仅首次（或标志变化落到
+ *          未初始化的分组时）重算大小与对齐偏移；热路径只做
+ *          基址对齐和减法套用缓存偏移
+ *
+ * @param extctx 扩展上下文布局指针
+ * @param sp 当前栈指针
+ *
+ * @return 新的栈指针地址
+ */
+static unsigned long setup_extcontext(struct extctx_layout *extctx, unsigned long sp)
+{
+    unsigned long base;
+    unsigned int flags = handle_flags();
+    unsigned int idx = ((flags & SC_USED_FP) != 0U) ? 1U : 0U;
+
+    if (!s_extctx_tmpl_valid[idx])
+    {
+        /* 模板内容幂等，多核竞态下重复构建无害；有效标志最后置位 */
+        extctx_build_template(&s_extctx_tmpl[idx], flags);
+        s_extctx_tmpl_valid[idx] = true;
+    }
+
+    *extctx = s_extctx_tmpl[idx];
+
+    /* 基址按各节对齐的公倍数对齐后，偏移与模板构建时逐字节一致 */
+    base = round_down(sp, EXTCTX_TMPL_ALIGN);
+    if (extctx->end.addr)
+        extctx->end.addr = (void *)(base - (unsigned long)extctx->end.addr);
+    if (extctx->lasx.addr)
+        extctx->lasx.addr = (void *)(base - (unsigned long)extctx->lasx.addr);
+    if (extctx->lsx.addr)
+        extctx->lsx.addr = (void *)(base - (unsigned long)extctx->lsx.addr);
+    if (extctx->fpu.addr)
+        extctx->fpu.addr = (void *)(base - (unsigned long)extctx->fpu.addr);
+    if (extctx->skip.addr)
+        extctx->skip.addr = (void *)(base - (unsigned long)extctx->skip.addr);
+#ifdef CONFIG_CPU_HAS_LBT
+    if (extctx->lbt.addr)
+        extctx->lbt.addr = (void *)(base - (unsigned long)extctx->lbt.addr);
+#endif
+
+    return base - extctx->size;
 }
 
 /**
@@ -1109,7 +1248,7 @@ int rt_sigreturn(struct arch_context *context)
     {
         goto badframe;
     }
-    if (copy_from_user(&set, &frame->rs_uctx.uc_sigmask, sizeof(set)))
+    if (arch_copy_from_user(&set, &frame->rs_uctx.uc_sigmask, sizeof(set)))
         goto badframe;
     set_current_blocked(&set);
     sig = restore_sigcontext(context, (struct sigcontext *)&frame->rs_uctx.uc_mcontext);
@@ -1117,7 +1256,7 @@ int rt_sigreturn(struct arch_context *context)
     context->regs[0] = 0; /* No syscall restarting */
     if (restore_altstack(&frame->rs_uctx.uc_stack, context->regs[3]))
         goto badframe;
-    memcpy(context, &frame->ctxt, sizeof(*context));
+    arch_memcpy_fast(context, &frame->ctxt, sizeof(*context));
     restore_fpu(frame);
 
     return context->regs[4];
@@ -1158,9 +1297,9 @@ static int setup_rt_frame(struct ksignal *ksig, struct arch_context *context, pr
     err |= __put_user(NULL, &frame->rs_uctx.uc_link);
     __save_altstack(&frame->rs_uctx.uc_stack, context->regs[3]);
     err |= setup_sigcontext(context, (struct sigcontext *)&frame->rs_uctx.uc_mcontext, &extctx);
-    memcpy(&frame->ctxt, context, sizeof(*context));
+    arch_memcpy_fast(&frame->ctxt, context, sizeof(*context));
     save_fpu(frame);
-    err |= copy_to_user(&frame->rs_uctx.uc_sigmask, set, sizeof(*set));
+    err |= arch_copy_to_user(&frame->rs_uctx.uc_sigmask, set, sizeof(*set));
     if (err)
 
         return -EFAULT;
@@ -1236,7 +1375,18 @@ int arch_do_signal(struct arch_context *context)
 {
     struct ksignal ksig;
     bool exist_signal = false;
-    bool is_in_syscall = in_syscall(context);
+    bool is_in_syscall;
+
+    /* 快速退出：标志字为零说明没有任何待处理工作，
+     * 一次load判零后直接返回，不展开信号检查逻辑；
+     * 开关未启用时test恒为非零，退回原路径 */
+    if (arch_work_pending_test() == 0U)
+    {
+        return 0;
+    }
+    arch_work_pending_clear(ARCH_WORK_SIGPENDING);
+
+    is_in_syscall = in_syscall(context);
     if (is_in_syscall)
     {
         /*
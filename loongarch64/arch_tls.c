@@ -3,10 +3,12 @@
  * @brief   LoongArch64线程本地存储（TLS）管理
  * @author  Intewell Team
  * @date    2025-01-21
- * @version 1.0
+ * @version 1.1
  *
  * @details 本文件实现线程本地存储（Thread Local Storage）功能
- *          - 设置TLS指针
+ *          - 设置TLS指针：与per-CPU缓存的已装载值比较，
+ *            未变化时跳过写入（同进程线程轮转与内核任务间
+ *            切换TP不变，条件化后切换路径省去寄存器写）
  *          - 获取TLS指针
  *          - 使用寄存器r2（tp寄存器）快速访问
  *
@@ -16,6 +18,8 @@
  * @copyright Copyright (c) 2025 Intewell Team
  */
 /*************************** 头文件包含 ****************************/
+#include <current.h>
+#include <percpu.h>
 #include <stdint.h>
 /*************************** 全局变量 ****************************/
 /**
@@ -27,22 +31,44 @@
  * @note r2是LoongArch架构专门用于线程指针的寄存器
  */
 register unsigned long __my_tls __asm__("$r2");
+
+/* 本核当前已装载的TLS值：切换路径比较后按需写入 */
+DEFINE_PER_CPU(uintptr_t, arch_tls_loaded);
 /*************************** 函数实现 ****************************/
 /**
  * @brief 设置线程本地存储指针
  *
- * @details 将TLS指针设置为指定的值
- *          同时更新硬件寄存器r2（tp）
+ * @details 与per-CPU缓存的已装载值比较，相同则直接返回；
+ *          变化时才更新硬件寄存器r2（tp）并刷新缓存
  *
  * @param tls 要设置的TLS指针值
  *
  * @return 无
  *
- * @note 此函数通常在线程创建时调用
+ * @note 性能关键路径：调用方保证关抢占（上下文切换中调用）
  */
 void kernel_set_tls(uintptr_t tls)
 {
+    if (this_cpu_read(arch_tls_loaded) == tls)
+    {
+        return;
+    }
+
     __my_tls = tls;
+    this_cpu_write(arch_tls_loaded, tls);
+}
+
+/**
+ * @brief 使本核TLS缓存失效
+ *
+ * @details 清零已装载值缓存，强制下一次kernel_set_tls写入；
+ *          TP可能被外部改写的路径（核启动、异常恢复调试）调用
+ *
+ * @return 无
+ */
+void kernel_tls_cache_invalidate(void)
+{
+    this_cpu_write(arch_tls_loaded, 0U);
 }
 
 /**
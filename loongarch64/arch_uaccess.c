@@ -18,6 +18,7 @@
  */
 
 /*************************** 头文件包含 ****************************/
+#include <asm-extable.h>
 #include <commonTypes.h>
 #include <errno.h>
 #include <mmu.h>
@@ -37,8 +38,54 @@
 #define ACCESS_W 2
 #define ACCESS_RW 4
 
+/**
+ * @brief 软件快表项数（每核，必须为2的幂）
+ */
+#define UA_TLB_SIZE 16U
+
+/**
+ * @brief 异常表保护的用户空间加载
+ *
+ * @details 访问出错由异常修复表回填：err置-EFAULT，目标寄存器清零
+ */
+#define UA_COPY_GET(insn, type, err, dst, src)                                                        \
+    do                                                                                                \
+    {                                                                                                 \
+        type __ua_val;                                                                                \
+        __asm__ __volatile__("1:    " insn "    %1, %2\n"                                             \
+                             "2:\n" _ASM_EXTABLE_UACCESS_ERR_ZERO(1b, 2b, %0, %1)                     \
+                             : "+r"(err), "=r"(__ua_val)                                              \
+                             : "m"(*(const type *)(src)));                                            \
+        *(type *)(dst) = __ua_val;                                                                    \
+    } while (0)
+
+/**
+ * @brief 异常表保护的用户空间存储
+ *
+ * @details 访问出错由异常修复表回填：err置-EFAULT
+ */
+#define UA_COPY_PUT(insn, type, err, dst, src)                                                        \
+    do                                                                                                \
+    {                                                                                                 \
+        type __ua_val = *(const type *)(src);                                                         \
+        __asm__ __volatile__("1:    " insn "    %z2, %1\n"                                            \
+                             "2:\n" _ASM_EXTABLE_UACCESS_ERR(1b, 2b, %0)                              \
+                             : "+r"(err), "=m"(*(type *)(dst))                                        \
+                             : "Jr"(__ua_val));                                                       \
+    } while (0)
+
 /*************************** 类型定义 ****************************/
 
+/**
+ * @brief 软件快表项：缓存一页已验证的页表遍历结果
+ */
+struct ua_tlb_entry
+{
+    virt_addr_t vpage;  /**< @brief 页对齐的虚拟地址（0表示无效） */
+    phys_addr_t pgdl;   /**< @brief 验证时的用户页表基址，用于地址空间隔离 */
+    uint64_t entry;     /**< @brief 缓存的最终页表项 */
+};
+
 /*************************** 外部声明 ****************************/
 
 /*************************** 前向声明 ****************************/
@@ -47,11 +94,214 @@ static uint64_t page_entry_get(phys_addr_t pte, int level, int idx);
 static bool is_page_dir(uint64_t ptable_entry);
 
 /*************************** 模块变量 ****************************/
+/* 直接映射的per-CPU软件快表：热路径重复校验退化为一次数组查找 */
+static struct ua_tlb_entry ua_tlb[CONFIG_MAX_CPUS][UA_TLB_SIZE] __attribute__((aligned(64)));
 
 /*************************** 全局变量 ****************************/
 
 /*************************** 函数实现 ****************************/
 
+/**
+ * @brief 无效化所有CPU的用户访问软件快表
+ *
+ * @details 用户页表被修改或解映射时调用，清除缓存的遍历结果
+ *
+ * @return 无
+ */
+void uaccess_tlb_flush_all(void)
+{
+    memset(ua_tlb, 0, sizeof(ua_tlb));
+}
+
+/**
+ * @brief 带软件快表的页表遍历
+ *
+ * @details 先查本核软件快表，命中则直接返回缓存的页表项；
+ *          未命中时执行真实遍历并回填。快表项用验证时的PGDL
+ *          做标签，地址空间切换后自然失效
+ *
+ * @param vpage 页对齐的虚拟地址
+ * @param pgdl 用户页表基址
+ *
+ * @return 最终页表项值，未映射返回0
+ */
+static uint64_t search_pgtable_cached(virt_addr_t vpage, phys_addr_t pgdl)
+{
+    struct ua_tlb_entry *slot;
+    uint64_t entry;
+    unsigned int idx = (vpage >> PAGE_SIZE_SHIFT) & (UA_TLB_SIZE - 1U);
+
+    slot = &ua_tlb[csr_read32(LOONGARCH_CSR_CPUID)][idx];
+    if ((slot->vpage == vpage) && (slot->pgdl == pgdl))
+    {
+        return slot->entry;
+    }
+    entry = search_pgtable(vpage, pgdl);
+    if (entry != 0)
+    {
+        slot->entry = entry;
+        slot->pgdl = pgdl;
+        slot->vpage = vpage;
+    }
+
+    return entry;
+}
+
+/**
+ * @brief 查询当前地址空间中一页的最终页表项
+ *
+ * @details 以当前PGDL为根遍历页表（经本核软件快表加速），
+ *          供coredump等按页扫描的调用方判断页面是否已映射
+ *
+ * @param vpage 页对齐的虚拟地址
+ *
+ * @return 最终页表项值，未映射返回0
+ */
+uint64_t uaccess_page_entry(uintptr_t vpage)
+{
+    return search_pgtable_cached((virt_addr_t)vpage, csr_read64(LOONGARCH_CSR_PGDL));
+}
+
+/**
+ * @brief 用户空间地址范围检查（仅边界）
+ *
+ * @details 只验证范围完全落在用户空间内，不遍历页表；
+ *          页面级权限由访问指令的异常修复表兜底
+ *
+ * @param addr 用户空间地址
+ * @param n 范围长度（字节）
+ *
+ * @return 合法返回true，越界返回false
+ */
+static bool user_range_check(const void *addr, unsigned long n)
+{
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = start + n;
+
+    if (end < start)
+    {
+        return false;
+    }
+
+    return (start >= (uintptr_t)USER_SPACE_START) && (end <= (uintptr_t)USER_SPACE_END);
+}
+
+/**
+ * @brief 单遍从用户空间拷贝数据
+ *
+ * @details 不预检查页表，访问指令带异常修复表注记，
+ *          页缺失或权限不足时由fixup_exception回填错误，
+ *          函数返回剩余未拷贝字节数
+ *
+ * @param to 目标地址（内核空间）
+ * @param from 源地址（用户空间）
+ * @param n 拷贝字节数
+ *
+ * @return 成功返回0，失败返回未拷贝的字节数
+ */
+unsigned long arch_copy_from_user(void *to, const void __user *from, unsigned long n)
+{
+    int err = 0;
+    uint8_t *dst = (uint8_t *)to;
+    const uint8_t *src = (const uint8_t *)from;
+
+    if (n == 0U)
+    {
+        return 0U;
+    }
+    if (!user_range_check(from, n))
+    {
+        return n;
+    }
+
+    /* 双方8字节对齐时按字拷贝，否则逐字节 */
+    if (((((uintptr_t)dst) | ((uintptr_t)src)) & 7U) == 0U)
+    {
+        while (n >= 8U)
+        {
+            UA_COPY_GET("ld.d", uint64_t, err, dst, src);
+            if (err != 0)
+            {
+                return n;
+            }
+            dst += 8U;
+            src += 8U;
+            n -= 8U;
+        }
+    }
+    while (n > 0U)
+    {
+        UA_COPY_GET("ld.b", uint8_t, err, dst, src);
+        if (err != 0)
+        {
+            return n;
+        }
+        dst++;
+        src++;
+        n--;
+    }
+
+    return 0U;
+}
+
+/**
+ * @brief 单遍向用户空间拷贝数据
+ *
+ * @details 不预检查页表，访问指令带异常修复表注记，
+ *          页缺失或权限不足时由fixup_exception回填错误，
+ *          函数返回剩余未拷贝字节数
+ *
+ * @param to 目标地址（用户空间）
+ * @param from 源地址（内核空间）
+ * @param n 拷贝字节数
+ *
+ * @return 成功返回0，失败返回未拷贝的字节数
+ */
+unsigned long arch_copy_to_user(void __user *to, const void *from, unsigned long n)
+{
+    int err = 0;
+    uint8_t *dst = (uint8_t *)to;
+    const uint8_t *src = (const uint8_t *)from;
+
+    if (n == 0U)
+    {
+        return 0U;
+    }
+    if (!user_range_check(to, n))
+    {
+        return n;
+    }
+
+    /* 双方8字节对齐时按字拷贝，否则逐字节 */
+    if (((((uintptr_t)dst) | ((uintptr_t)src)) & 7U) == 0U)
+    {
+        while (n >= 8U)
+        {
+            UA_COPY_PUT("st.d", uint64_t, err, dst, src);
+            if (err != 0)
+            {
+                return n;
+            }
+            dst += 8U;
+            src += 8U;
+            n -= 8U;
+        }
+    }
+    while (n > 0U)
+    {
+        UA_COPY_PUT("st.b", uint8_t, err, dst, src);
+        if (err != 0)
+        {
+            return n;
+        }
+        dst++;
+        src++;
+        n--;
+    }
+
+    return 0U;
+}
+
 /**
  * @brief 用户空间访问权限检查
  *
@@ -95,7 +345,7 @@ bool user_access_check(const void __user *user_addr, unsigned long n, int flag)
     mmu_check_size = roundup(n, PAGE_SIZE);
     while (mmu_check_size > 0)
     {
-        ptable_entry = search_pgtable(mmu_check_start, csr_read64(LOONGARCH_CSR_PGDL));
+        ptable_entry = search_pgtable_cached(mmu_check_start, csr_read64(LOONGARCH_CSR_PGDL));
         switch (flag)
         {
         case UACCESS_R:
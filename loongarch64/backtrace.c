@@ -37,6 +37,13 @@
  */
 #define UNWIND_LIMIT 20U
 
+/**
+ * @brief 符号地址索引容量
+ *
+ * @details 超过容量时退回线性查找，功能不受影响
+ */
+#define BACKTRACE_SYM_MAX 4096
+
 /*************************** 数据结构 ****************************/
 /**
  * @brief 帧记录结构
@@ -51,6 +58,21 @@ struct frame_record
     uintptr_t return_addr;       /**< @brief 返回地址 */
 };
 
+/*************************** 外部声明 ****************************/
+/* 内核text段边界（链接脚本link.lds提供） */
+extern char _stext[];
+extern char _etext[];
+
+/*************************** 模块变量 ****************************/
+/* 按地址升序排列的符号索引，指向g_allsyms中的项 */
+static const struct symtab_item *s_sym_index[BACKTRACE_SYM_MAX];
+
+/* 索引中有效项数，为0时退回线性查找 */
+static int s_sym_count;
+
+/* 索引是否已构建 */
+static bool s_sym_index_valid;
+
 /*************************** 内部函数声明 ****************************/
 /**
  * @brief 检查地址是否可读
@@ -101,7 +123,118 @@ static bool is_valid_frame_record(struct frame_record *fr);
  */
 static void unwind_stack(struct frame_record *fr, uintptr_t current_pc, uintptr_t ra, bool skip_current);
 
+/**
+ * @brief 按地址二分查找符号
+ *
+ * @param addr 指令地址
+ *
+ * @return 地址所属符号项指针，未找到返回NULL
+ */
+static const struct symtab_item *backtrace_sym_lookup(uintptr_t addr);
+
 /*************************** 函数实现 ****************************/
+/**
+ * @brief 构建符号地址二分索引
+ *
+ * @details 把g_allsyms中的符号按地址升序排入索引数组，
+ *          使回溯时的符号查询从O(n)线性扫描降为O(log n)二分查找。
+ *          排序使用迭代的希尔排序（禁止递归），仅启动时执行一次
+ *
+ * @note 启动阶段（单核）调用；重复调用为幂等空操作
+ */
+void backtrace_symtab_init(void)
+{
+    int gap;
+    int i;
+    int j;
+    int count = g_nallsyms;
+
+    if (s_sym_index_valid)
+    {
+        return;
+    }
+
+    /* 符号数超出容量时不建索引，查询退回线性扫描 */
+    if ((count <= 0) || (count > BACKTRACE_SYM_MAX))
+    {
+        s_sym_count = 0;
+        s_sym_index_valid = true;
+        return;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        s_sym_index[i] = &g_allsyms[i];
+    }
+
+    /* 希尔排序：按sym_value升序，迭代实现 */
+    for (gap = count / 2; gap > 0; gap /= 2)
+    {
+        for (i = gap; i < count; i++)
+        {
+            const struct symtab_item *item = s_sym_index[i];
+
+            for (j = i; (j >= gap) && (s_sym_index[j - gap]->sym_value > item->sym_value); j -= gap)
+            {
+                s_sym_index[j] = s_sym_index[j - gap];
+            }
+            s_sym_index[j] = item;
+        }
+    }
+
+    s_sym_count = count;
+    s_sym_index_valid = true;
+}
+
+/**
+ * @brief 按地址二分查找符号
+ *
+ * @details 在排序索引中查找地址所属符号（不大于addr的最大符号地址），
+ *          单次查找约log2(n)次比较；索引不可用时退回线性查找
+ *
+ * @param addr 指令地址
+ *
+ * @return 地址所属符号项指针，未找到返回NULL
+ */
+static const struct symtab_item *backtrace_sym_lookup(uintptr_t addr)
+{
+    const struct symtab_item *found = NULL;
+    int lo;
+    int hi;
+
+    if (!s_sym_index_valid)
+    {
+        backtrace_symtab_init();
+    }
+
+    if (s_sym_count == 0)
+    {
+        size_t size;
+
+        return allsyms_findbyvalue((void *)addr, &size);
+    }
+
+    lo = 0;
+    hi = s_sym_count - 1;
+
+    while (lo <= hi)
+    {
+        int mid = lo + ((hi - lo) / 2);
+
+        if ((uintptr_t)s_sym_index[mid]->sym_value <= addr)
+        {
+            found = s_sym_index[mid];
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid - 1;
+        }
+    }
+
+    return found;
+}
+
 /**
  * @brief 检查地址是否可读
  *
@@ -150,13 +283,10 @@ static bool is_valid_object(uintptr_t addr, size_t size)
         return false;
     }
 
-    /* 检查对象的所有字节是否可读 */
-    for (size_t i = 0U; i < size; i++)
+    /* 只探测首尾字节：映射以页为粒度，首尾可读即整体可读 */
+    if (!is_address_readable(addr) || !is_address_readable((addr + size) - 1U))
     {
-        if (!is_address_readable(addr + i))
-        {
-            return false;
-        }
+        return false;
     }
 
     return true;
@@ -165,7 +295,9 @@ static bool is_valid_object(uintptr_t addr, size_t size)
 /**
  * @brief 检查跳转地址是否有效
  *
- * @details 检查地址是否正确对齐且指向有效的内存区域
+ * @details 检查地址是否正确对齐且落在内核text段内。
+ *          text段边界由链接脚本符号_stext/_etext给出，
+ *          两次比较即可判定，替代逐字节的可读性扫描
  *
  * @param addr 跳转地址
  *
@@ -173,18 +305,14 @@ static bool is_valid_object(uintptr_t addr, size_t size)
  */
 static bool is_valid_jump_address(uintptr_t addr)
 {
-    if (addr == 0U)
-    {
-        return false;
-    }
-
     /* 检查对齐：LoongArch64指令为32位（4字节） */
     if ((addr & (sizeof(uint32_t) - 1U)) != 0U)
     {
         return false;
     }
 
-    if (!is_address_readable(addr))
+    /* 合法的调用点必定在内核text段内（同时排除NULL） */
+    if ((addr < (uintptr_t)_stext) || (addr >= (uintptr_t)_etext))
     {
         return false;
     }
@@ -235,8 +363,7 @@ static void unwind_stack(struct frame_record *fr, uintptr_t current_pc, uintptr_
     /* 回溯的第0层是当前backtrace函数 */
     if (!skip_current)
     {
-        size_t size;
-        const struct symtab_item *sym = allsyms_findbyvalue((void *)current_pc, &size);
+        const struct symtab_item *sym = backtrace_sym_lookup(current_pc);
         KLOG_EMERG(backtrace_str, 0U, el_str, current_pc, sym != NULL ? sym->sym_name : "??",
                    (uint32_t)(current_pc - (uintptr_t)(sym != NULL ? sym->sym_value : 0U)));
     }
@@ -268,8 +395,7 @@ static void unwind_stack(struct frame_record *fr, uintptr_t current_pc, uintptr_
         }
 
         {
-            size_t size;
-            const struct symtab_item *sym = allsyms_findbyvalue((void *)call_site, &size);
+            const struct symtab_item *sym = backtrace_sym_lookup(call_site);
             KLOG_EMERG(backtrace_str, i, el_str, call_site, sym != NULL ? sym->sym_name : "??",
                        (uint32_t)(call_site - (uintptr_t)(sym != NULL ? sym->sym_value : 0U)));
         }
@@ -316,6 +442,78 @@ void backtrace(const char *cookie)
     KLOG_EMERG("BACKTRACE: END: %s", cookie);
 }
 
+/**
+ * @brief 捕获当前调用栈到定长缓冲区
+ *
+ * @details 从当前帧开始沿帧记录链提取各层调用点地址，
+ *          不做符号解析、不打印，适合在中断上下文中快速执行
+ *          （跨核backtrace快照的目标核侧采集路径）
+ *
+ * @param buf 输出缓冲区，逐层存放调用点地址
+ * @param max 缓冲区容量（地址个数）
+ *
+ * @return 实际捕获的层数
+ *
+ * @note 性能关键路径：调用方保证buf有效
+ */
+unsigned int backtrace_capture(uintptr_t *buf, unsigned int max)
+{
+    struct frame_record *fr = __builtin_frame_address(0U);
+    unsigned int depth = 0U;
+    uintptr_t call_site;
+
+    if (max > UNWIND_LIMIT)
+    {
+        max = UNWIND_LIMIT;
+    }
+
+    while (depth < max)
+    {
+        if (!is_valid_frame_record(fr))
+        {
+            break;
+        }
+
+        /* 调用点在返回地址前4字节处（指令定长4字节） */
+        call_site = fr->return_addr - 4U;
+        if (!is_valid_jump_address(call_site))
+        {
+            break;
+        }
+
+        buf[depth] = call_site;
+        depth++;
+        fr = fr->parent;
+    }
+
+    return depth;
+}
+
+/**
+ * @brief 符号化打印一组调用点地址
+ *
+ * @details 对backtrace_capture采集的地址快照逐层做符号查询并
+ *          输出，格式与backtrace()一致；发起核收集到跨核快照
+ *          后调用本函数完成符号化，目标核侧不承担打印开销
+ *
+ * @param cpu   快照来源CPU编号（仅用于输出标识）
+ * @param addrs 调用点地址数组
+ * @param count 地址个数
+ */
+void backtrace_snapshot_print(unsigned int cpu, const uintptr_t *addrs, unsigned int count)
+{
+    KLOG_EMERG("BACKTRACE: START: cpu%u", cpu);
+
+    for (unsigned int i = 0U; i < count; i++)
+    {
+        const struct symtab_item *sym = backtrace_sym_lookup(addrs[i]);
+        KLOG_EMERG("%u: caller: 0x%lx (%s + 0x%x)", i, addrs[i], sym != NULL ? sym->sym_name : "??",
+                   (uint32_t)(addrs[i] - (uintptr_t)(sym != NULL ? sym->sym_value : 0U)));
+    }
+
+    KLOG_EMERG("BACKTRACE: END: cpu%u", cpu);
+}
+
 /**
  * @brief 从指定帧地址开始回溯栈
  *
@@ -0,0 +1,140 @@
+/**
+ * @file    boot_trace.c
+ * @brief   启动阶段耗时追踪实现
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件实现轻量启动耗时追踪设施
+ *          - 打点写入静态数组，阶段名只存指针，打点开销为一次
+ *            rdtime.d读取与两次存储
+ *          - crt1.S以全局变量交接_start入口与C就绪两处汇编
+ *            时间戳，进入C环境后归入报表
+ *          - 报表按相邻打点差值输出各阶段耗时，微秒换算用
+ *            ttos_time_freq_get的计数器频率
+ *
+ * @note MISRA-C:2012 合规
+ * @note 仅限启动阶段单核顺序调用，不加锁
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#define KLOG_TAG "boottrace"
+
+/*************************** 头文件包含 ****************************/
+#include <boot-trace.h>
+#include <cpu.h>
+#include <klog.h>
+#include <ttos_time.h>
+
+/*************************** 宏定义 ****************************/
+/* 打点表容量（超出后丢弃，报表提示截断） */
+#define BOOT_TRACE_SLOTS 32U
+
+/*************************** 数据结构 ****************************/
+/**
+ * @brief 单个启动打点
+ */
+struct boot_trace_stamp
+{
+    const char *name; /**< @brief 阶段名称 */
+    u64 tsc;          /**< @brief rdtime.d时间戳 */
+};
+
+/*************************** 全局变量 ****************************/
+/* crt1.S写入的_start入口时间戳（BSS清零后存入，见crt1.S） */
+u64 g_boot_trace_asm_entry = 0U;
+
+/* crt1.S写入的C环境就绪时间戳 */
+u64 g_boot_trace_asm_cready = 0U;
+
+/*************************** 模块变量 ****************************/
+/* 打点表与已用槽数 */
+static struct boot_trace_stamp s_stamps[BOOT_TRACE_SLOTS];
+static u32 s_stamp_count = 0U;
+
+/* 打点表溢出标志 */
+static u32 s_overflow = 0U;
+
+/*************************** 函数实现 ****************************/
+
+/**
+ * @brief 以指定时间戳记录一个启动阶段打点
+ *
+ * @param name 阶段名称（须为静态字符串，只保存指针）
+ * @param tsc  rdtime.d时间戳
+ */
+void boot_trace_mark_tsc(const char *name, u64 tsc)
+{
+    if (s_stamp_count >= BOOT_TRACE_SLOTS)
+    {
+        s_overflow = 1U;
+
+        return;
+    }
+
+    s_stamps[s_stamp_count].name = name;
+    s_stamps[s_stamp_count].tsc = tsc;
+    s_stamp_count++;
+}
+
+/**
+ * @brief 记录一个启动阶段打点
+ *
+ * @param name 阶段名称（须为静态字符串，只保存指针）
+ */
+void boot_trace_mark(const char *name)
+{
+    boot_trace_mark_tsc(name, drdtime());
+}
+
+/**
+ * @brief 导入crt1.S记录的汇编阶段时间戳
+ *
+ * @details _start入口与C环境就绪两处打点按时间顺序放在
+ *          报表最前；未记录（时间戳为0）时跳过
+ */
+void boot_trace_asm_import(void)
+{
+    if (g_boot_trace_asm_entry != 0U)
+    {
+        boot_trace_mark_tsc("asm-entry", g_boot_trace_asm_entry);
+    }
+    if (g_boot_trace_asm_cready != 0U)
+    {
+        boot_trace_mark_tsc("asm-c-ready", g_boot_trace_asm_cready);
+    }
+}
+
+/**
+ * @brief 输出分阶段启动耗时报表
+ *
+ * @details 第一行输出各打点绝对计数，随后按相邻打点差值输出
+ *          各阶段耗时；计数器频率可得时附带微秒换算
+ */
+void boot_trace_report(void)
+{
+    u64 freq = ttos_time_freq_get();
+    u32 i;
+
+    if (s_stamp_count == 0U)
+    {
+        return;
+    }
+
+    KLOG_I("boot trace: %u stamps, counter freq %u Hz%s",
+           s_stamp_count, (u32)freq, (s_overflow != 0U) ? " (truncated)" : "");
+
+    for (i = 1U; i < s_stamp_count; i++)
+    {
+        u64 delta = s_stamps[i].tsc - s_stamps[i - 1U].tsc;
+        u64 us = (freq != 0U) ? ((delta * 1000000U) / freq) : 0U;
+
+        KLOG_I("  %-20s -> %-20s : %llu cycles (%llu us)",
+               s_stamps[i - 1U].name, s_stamps[i].name,
+               (unsigned long long)delta, (unsigned long long)us);
+    }
+
+    KLOG_I("  total: %llu cycles",
+           (unsigned long long)(s_stamps[s_stamp_count - 1U].tsc - s_stamps[0].tsc));
+}
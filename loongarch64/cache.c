@@ -17,18 +17,206 @@
  * @copyright Copyright (c) 2025 AISafe64 Team
  */
 /*************************** 头文件包含 ****************************/
+#include <cache-adaptive.h>
+#include <cache-text.h>
 #include <cpu.h>
+#include <larchintrin.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <system/macros.h>
 #include <system/types.h>
 #include <util.h>
 /*************************** 宏定义 ****************************/
+/* 未探测时的保守缓存行大小（字节） */
+#define CACHE_LINE_SIZE_DEFAULT 64U
+
+/* cacop命中类操作码：(2<<3)|leaf，命中即写回并无效该行 */
+#define CACHE_HIT_WB_INV_L1D 0x11
+#define CACHE_HIT_WB_INV_L2 0x12
+#define CACHE_HIT_WB_INV_L3 0x13
 /*************************** 类型定义 ****************************/
 /*************************** 全局变量 ****************************/
+/* L1D缓存行大小（探测值，未探测按64字节） */
+static u32 s_dcache_line_size = CACHE_LINE_SIZE_DEFAULT;
+
+/* 末级数据缓存容量（字节，0表示未探测） */
+static size_t s_llc_size = 0U;
+
+/* 按行/全量切换阈值（字节，0表示未探测，范围路径退化为全量） */
+static size_t s_range_threshold = 0U;
+
+/* L2/L3数据缓存存在标志（决定按行路径需命中的层级） */
+static int s_has_l2 = 0;
+static int s_has_l3 = 0;
 /*************************** 外部声明 ****************************/
 void cache_dcache_flush(size_t vaddr_start, size_t len);
+int arch_dcache_invd_all(void);
+int dcache_flush_and_invd_all(void);
+/*************************** 内部函数声明 ****************************/
+static size_t cache_level_size(u32 cfg);
+static void cache_wb_inv_lines(size_t vaddr_start, size_t len);
 /*************************** 函数实现 ****************************/
+/**
+ * @brief 按CPUCFG17~20格式计算单级缓存容量
+ *
+ * @details 容量 = 路数 * 组数 * 行大小；组数与行大小字段为log2值
+ *
+ * @param cfg CPUCFG17~20寄存器值
+ *
+ * @return 该级缓存容量（字节）
+ */
+static size_t cache_level_size(u32 cfg)
+{
+    size_t ways = (size_t)(cfg & CPUCFG_CACHE_WAYS_M) + 1U;
+    size_t sets = (size_t)1U << ((cfg & CPUCFG_CACHE_SETS_M) >> CPUCFG_CACHE_SETS);
+    size_t lsize = (size_t)1U << ((cfg & CPUCFG_CACHE_LSIZE_M) >> CPUCFG_CACHE_LSIZE);
+
+    return ways * sets * lsize;
+}
+
+/**
+ * @brief 探测缓存几何参数
+ *
+ * @details 读CPUCFG16确定各级数据/统一缓存存在性，再经
+ *          CPUCFG18~20取行大小与容量；末级缓存容量即按行/全量
+ *          切换阈值——范围达到该规模后逐行命中不再有收益
+ *
+ * @note 启动阶段单核调用一次，结果对所有核有效
+ */
+void cache_geometry_init(void)
+{
+    u32 cfg16 = read_cpucfg(LOONGARCH_CPUCFG16);
+    u32 cfg;
+
+    if ((cfg16 & CPUCFG16_L1_DPRE) != 0U)
+    {
+        cfg = read_cpucfg(LOONGARCH_CPUCFG18);
+        s_dcache_line_size =
+            (u32)1U << ((cfg & CPUCFG_CACHE_LSIZE_M) >> CPUCFG_CACHE_LSIZE);
+        s_llc_size = cache_level_size(cfg);
+    }
+
+    if (((cfg16 & CPUCFG16_L2_IUPRE) != 0U) || ((cfg16 & CPUCFG16_L2_DPRE) != 0U))
+    {
+        s_has_l2 = 1;
+        s_llc_size = cache_level_size(read_cpucfg(LOONGARCH_CPUCFG19));
+    }
+
+    if (((cfg16 & CPUCFG16_L3_IUPRE) != 0U) || ((cfg16 & CPUCFG16_L3_DPRE) != 0U))
+    {
+        s_has_l3 = 1;
+        s_llc_size = cache_level_size(read_cpucfg(LOONGARCH_CPUCFG20));
+    }
+
+    s_range_threshold = s_llc_size;
+}
+
+/**
+ * @brief 获取探测到的数据缓存行大小
+ *
+ * @return 行大小（字节），未探测时返回64
+ */
+u32 cache_line_size_get(void)
+{
+    return s_dcache_line_size;
+}
+
+/**
+ * @brief 获取探测到的末级缓存容量
+ *
+ * @return 末级缓存容量（字节），未探测时返回0
+ */
+size_t cache_llc_size_get(void)
+{
+    return s_llc_size;
+}
+
+/**
+ * @brief 按行写回并无效指定范围
+ *
+ * @details 以探测行大小为步长，对范围内每行逐级发出cacop命中
+ *          写回无效；命中类操作未命中时为空操作，范围外无副作用
+ *
+ * @param vaddr_start 起始虚拟地址
+ * @param len         长度（字节）
+ *
+ * @note 性能关键路径：调用方保证len非0
+ */
+static void cache_wb_inv_lines(size_t vaddr_start, size_t len)
+{
+    size_t lsize = (size_t)s_dcache_line_size;
+    size_t addr = vaddr_start & ~(lsize - 1U);
+    size_t end = vaddr_start + len;
+
+    while (addr < end)
+    {
+        __cacop_d(CACHE_HIT_WB_INV_L1D, addr, 0);
+        if (s_has_l2 != 0)
+        {
+            __cacop_d(CACHE_HIT_WB_INV_L2, addr, 0);
+        }
+        if (s_has_l3 != 0)
+        {
+            __cacop_d(CACHE_HIT_WB_INV_L3, addr, 0);
+        }
+        addr += lsize;
+    }
+
+    __asm__ volatile("\tdbar 0\n" ::: "memory");
+}
+
+/**
+ * @brief 自适应写回并无效指定范围的数据缓存
+ *
+ * @details 范围小于阈值走按行路径，否则全量操作；
+ *          未探测（阈值为0）时保守走全量路径
+ *
+ * @param vaddr_start 起始虚拟地址
+ * @param len         长度（字节）
+ */
+void cache_dcache_flush_adaptive(size_t vaddr_start, size_t len)
+{
+    if (len == 0U)
+    {
+        return;
+    }
+
+    if ((s_range_threshold != 0U) && (len < s_range_threshold))
+    {
+        cache_wb_inv_lines(vaddr_start, len);
+    }
+    else
+    {
+        (void)dcache_flush_and_invd_all();
+    }
+}
+
+/**
+ * @brief 自适应使指定范围的数据缓存无效
+ *
+ * @details cacop命中类操作语义为写回并无效，无效与写回无效
+ *          复用同一按行路径；范围达到阈值走全量操作
+ *
+ * @param vaddr_start 起始虚拟地址
+ * @param len         长度（字节）
+ */
+void cache_dcache_invd_adaptive(size_t vaddr_start, size_t len)
+{
+    if (len == 0U)
+    {
+        return;
+    }
+
+    if ((s_range_threshold != 0U) && (len < s_range_threshold))
+    {
+        cache_wb_inv_lines(vaddr_start, len);
+    }
+    else
+    {
+        (void)arch_dcache_invd_all();
+    }
+}
+
 /**
  * @brief 更新指令缓存
  *
@@ -50,6 +238,117 @@ void cache_text_update(size_t vaddr_start, size_t len)
     __asm__ volatile("\tibar 0\n" ::: "memory");
 }
 
+/**
+ * @brief 同步单个修补区间的数据缓存
+ *
+ * @details LoongArch硬件维护ICache/DCache一致性，写入的指令
+ *          无需显式数据缓存清洗；保留区间参数以便非一致性
+ *          平台在此补充按行写回
+ *
+ * @param vaddr_start 修补起始虚拟地址
+ * @param len         修补长度（字节）
+ */
+static void cache_text_range_sync(size_t vaddr_start, size_t len)
+{
+    (void)vaddr_start;
+    (void)len;
+}
+
+/**
+ * @brief 初始化批量修补上下文
+ *
+ * @param batch 批量上下文（不能为NULL）
+ */
+void cache_text_batch_init(struct cache_text_batch *batch)
+{
+    batch->count = 0U;
+}
+
+/**
+ * @brief 收集一个修补区间
+ *
+ * @details 线性扫描已收集区间，与重叠或相邻者就地合并，
+ *          避免区间表被连续重定位点撑爆；表满时自动提交
+ *          当前批次后继续收集，接口不失败
+ *
+ * @param batch       批量上下文（不能为NULL）
+ * @param vaddr_start 修补起始虚拟地址
+ * @param len         修补长度（字节）
+ */
+void cache_text_batch_add(struct cache_text_batch *batch, size_t vaddr_start, size_t len)
+{
+    size_t start = vaddr_start;
+    size_t end = vaddr_start + len;
+    u32 i;
+
+    if (len == 0U)
+    {
+        return;
+    }
+
+    /* 与已有区间重叠或相邻时就地合并（重定位点多为连续地址） */
+    for (i = 0U; i < batch->count; i++)
+    {
+        size_t cur_start = batch->addr[i];
+        size_t cur_end = cur_start + batch->len[i];
+
+        if ((start <= cur_end) && (end >= cur_start))
+        {
+            if (start < cur_start)
+            {
+                cur_start = start;
+            }
+            if (end > cur_end)
+            {
+                cur_end = end;
+            }
+            batch->addr[i] = cur_start;
+            batch->len[i] = cur_end - cur_start;
+
+            return;
+        }
+    }
+
+    /* 区间表满：提交当前批次后从空表继续收集 */
+    if (batch->count >= CACHE_TEXT_BATCH_SLOTS)
+    {
+        cache_text_batch_flush(batch);
+    }
+
+    batch->addr[batch->count] = start;
+    batch->len[batch->count] = len;
+    batch->count++;
+}
+
+/**
+ * @brief 提交批量修补的缓存同步
+ *
+ * @details 逐区间同步数据缓存后只执行一次ibar，数千个修补点
+ *          的指令屏障开销由每点一次降为每批一次；提交后清空
+ *          上下文以便复用
+ *
+ * @param batch 批量上下文（不能为NULL）
+ */
+void cache_text_batch_flush(struct cache_text_batch *batch)
+{
+    u32 i;
+
+    if (batch->count == 0U)
+    {
+        return;
+    }
+
+    for (i = 0U; i < batch->count; i++)
+    {
+        cache_text_range_sync(batch->addr[i], batch->len[i]);
+    }
+
+    /* 屏障只在批次末尾执行一次 */
+    __asm__ volatile("\tibar 0\n" ::: "memory");
+
+    batch->count = 0U;
+}
+
 /**
  * @brief 刷新本地指令缓存范围
  *
@@ -15,6 +15,7 @@
  */
 /*************************** 头文件包含 ****************************/
 #include <context.h>
+#include <fpu-lazy.h>
 #include <ttos.h>
 #include <ttosInterHal.h>
 /*************************** 函数实现 ****************************/
@@ -23,6 +24,7 @@
  *
  * @details 保存当前CPU的虚拟中断标志到任务控制块
  *          用于任务切换时保存CPU状态
+ *          浮点/向量状态惰性保存：仅在任务使用过相应单元时落盘
  *
  * @param task 任务控制块指针（不能为NULL）
  * @param msr  机器状态值（包含虚拟中断标志）
@@ -34,6 +36,7 @@
 void arch_context_save_cpu_state(T_TTOS_TaskControlBlock *task, long msr)
 {
     task->switchContext.vintflag = msr;
+    lazy_fpu_switch_out(task);
 }
 
 /**
@@ -3,45 +3,187 @@
  * @brief   LoongArch64核心转储功能
  * @author  Intewell Team
  * @date    2025-01-21
- * @version 1.0
+ * @version 1.1
  *
  * @details 本文件实现核心转储功能
  *          - 保存进程异常时的寄存器信息
- *          - 生成ELF格式的核心转储文件
+ *          - 流式转储用户内存：按页查表、零页稀疏化、边读边写
  *
  * @note MISRA-C:2012 合规
- * @warning 当前为占位实现，功能待完善
  *
  * @copyright Copyright (c) 2025 Intewell Team
  */
 
 /*************************** 头文件包含 ****************************/
+#include <arch-uaccess.h>
+#include <coredump-stream.h>
 #include <coredump.h>
+#include <errno.h>
+#include <pageTable.h>
+#include <string.h>
 #include <ttosProcess.h>
 
 /*************************** 宏定义 ****************************/
 
+/**
+ * @brief 零页检测的展开步长（字节，一个缓存行）
+ */
+#define ZERO_SCAN_STRIDE 64U
+
 /*************************** 类型定义 ****************************/
 
 /*************************** 全局变量 ****************************/
 
+/*************************** 内部函数声明 ****************************/
+static bool page_is_zero(const void *page);
+
 /*************************** 函数实现 ****************************/
+/**
+ * @brief 检测一页是否全零
+ *
+ * @details 以64位字按缓存行步长展开比较，首个非零字立即返回；
+ *          不使用LSX向量比较：惰性FPU策略下内核上下文不持有
+ *          向量寄存器状态，或运算归并的标量展开已达访存带宽
+ *
+ * @param page 页起始地址（页对齐，调用方保证已映射）
+ *
+ * @return 全零返回true，否则返回false
+ */
+static bool page_is_zero(const void *page)
+{
+    const uint64_t *p = (const uint64_t *)page;
+    size_t i;
+
+    for (i = 0U; i < (PAGE_SIZE / sizeof(uint64_t)); i += (ZERO_SCAN_STRIDE / sizeof(uint64_t)))
+    {
+        uint64_t acc = p[i] | p[i + 1U] | p[i + 2U] | p[i + 3U] |
+                       p[i + 4U] | p[i + 5U] | p[i + 6U] | p[i + 7U];
+
+        if (acc != 0U)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief 流式转储一段用户虚拟地址范围
+ *
+ * @details 逐页经uaccess_page_entry查页表，未映射页与全零页
+ *          合并累积为稀疏洞，在洞与数据的边界处一次性经skip
+ *          回调写出；连续非零页同样合并为一段经emit回调写出，
+ *          全程直接引用用户页，不做整体缓冲，转储耗时只取决
+ *          于实际驻留数据量与输出端带宽
+ *
+ * @param start 起始虚拟地址（页对齐）
+ * @param end   结束虚拟地址（页对齐，不含）
+ * @param emit  数据写出回调（不能为NULL）
+ * @param skip  稀疏洞跳过回调（不能为NULL）
+ * @param priv  回调私有上下文
+ *
+ * @return 成功返回0，参数非法返回-EINVAL，回调失败时透传其错误码
+ *
+ * @note 须在目标进程的地址空间上下文中调用
+ */
+s32 elf_dump_memory(uintptr_t start, uintptr_t end, coredump_emit_fn emit, coredump_skip_fn skip, void *priv)
+{
+    uintptr_t vpage;
+    uintptr_t run_start = 0U;
+    size_t run_len = 0U;
+    size_t hole_len = 0U;
+    s32 ret;
+
+    if ((emit == NULL) || (skip == NULL) || (start > end) ||
+        ((start & (PAGE_SIZE - 1U)) != 0U) || ((end & (PAGE_SIZE - 1U)) != 0U))
+    {
+        return -EINVAL;
+    }
+
+    for (vpage = start; vpage < end; vpage += PAGE_SIZE)
+    {
+        bool resident = (uaccess_page_entry(vpage) != 0U) && (page_is_zero((const void *)vpage) == false);
+
+        if (resident)
+        {
+            /* 洞到数据的边界：先把累积的洞一次性写出 */
+            if (hole_len != 0U)
+            {
+                ret = skip(priv, hole_len);
+                if (ret != 0)
+                {
+                    return ret;
+                }
+                hole_len = 0U;
+            }
+            if (run_len == 0U)
+            {
+                run_start = vpage;
+            }
+            run_len += PAGE_SIZE;
+        }
+        else
+        {
+            /* 数据到洞的边界：先把累积的连续数据段写出 */
+            if (run_len != 0U)
+            {
+                ret = emit(priv, (const void *)run_start, run_len);
+                if (ret != 0)
+                {
+                    return ret;
+                }
+                run_len = 0U;
+            }
+            hole_len += PAGE_SIZE;
+        }
+    }
+
+    /* 收尾：写出最后一段数据或洞 */
+    if (run_len != 0U)
+    {
+        ret = emit(priv, (const void *)run_start, run_len);
+        if (ret != 0)
+        {
+            return ret;
+        }
+    }
+    if (hole_len != 0U)
+    {
+        ret = skip(priv, hole_len);
+        if (ret != 0)
+        {
+            return ret;
+        }
+    }
+
+    return 0;
+}
+
 /**
  * @brief 保存进程寄存器信息到核心转储
  *
- * @details 保存进程发生用户态异常时的寄存器信息
- *          从异常上下文获取寄存器状态
+ * @details 从进程的异常上下文复制通用寄存器与关键CSR，
+ *          按ELF prstatus的寄存器布局填充：
+ *          - [0..31]  通用寄存器r0-r31
+ *          - [32]     orig_a0（系统调用原始a0）
+ *          - [33]     csr_era（异常返回地址）
+ *          - [34]     csr_badvaddr（出错地址）
  *
- * @param status 保存的目标位置
- * @param pcb    目标进程控制块
+ * @param status 保存的目标位置（不能为NULL）
+ * @param pcb    目标进程控制块（不能为NULL）
  *
  * @return 无
- *
- * @note 当前为占位实现
  */
 void elf_save_regs(elf_prstatus_t *status, pcb_t pcb)
 {
-    printk("not support now !!! \n\r");
+    if ((status == NULL) || (pcb == NULL))
+    {
+        return;
+    }
 
-    return;
+    memcpy(&status->pr_reg[0], pcb->exception_context.regs, sizeof(pcb->exception_context.regs));
+    status->pr_reg[32] = pcb->exception_context.orig_a0;
+    status->pr_reg[33] = pcb->exception_context.csr_era;
+    status->pr_reg[34] = pcb->exception_context.csr_badvaddr;
 }
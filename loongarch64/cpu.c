@@ -18,6 +18,7 @@
  */
 
 /*************************** 头文件包含 ****************************/
+#include <arch-bitops.h>
 #include <cpu.h>
 #include <driver/cpudev.h>
 #include <limits.h>
@@ -107,12 +108,12 @@ bool is_bootcpu(void)
  *
  * @return 返回第一个零位的位置（0-based），如果全为1则返回-1
  *
- * @note 使用__builtin_ffsl内建函数实现
- * @note __builtin_ffsl返回第一个1的位置，因此需要先按位取反
+ * @note 使用bitops库的ctz.d单指令实现，任何输入都是固定周期
+ * @note 对1的位置扫描取反后进行，全1输入由ffs语义折算为-1
  */
 unsigned long ttos_ffz(unsigned long x)
 {
-    return (unsigned long)(__builtin_ffsl(~x) - 1U);
+    return (unsigned long)arch_ffs64(~(u64)x) - 1UL;
 }
 
 /**
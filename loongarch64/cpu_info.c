@@ -266,6 +266,12 @@ static void cpu_probe_common(struct cpuinfo_loongarch *c)
         elf_hwcap |= HWCAP_LOONGARCH_LSPW;
     }
 
+    /* 探测sc.q（128位条件存储）支持 */
+    if (config & CPUCFG2_SCQ)
+    {
+        c->options |= LOONGARCH_CPU_SCQ;
+    }
+
     /* 探测虚拟化支持 */
     if (config & CPUCFG2_LVZP)
     {
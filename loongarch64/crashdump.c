@@ -0,0 +1,182 @@
+/**
+ * @file    crashdump.c
+ * @brief   崩溃上下文快速持久化实现
+ * @author  Intewell Team
+ * @date    2025-08-29
+ * @version 1.0
+ *
+ * @details 本文件实现崩溃快存功能
+ *          - 致命异常路径把异常上下文、回溯地址快照和klog环
+ *            缓冲二进制写入跨重启保留的RAM区域，全程仅内存
+ *            拷贝，毫秒级完成即可交由看门狗复位
+ *          - 保留区经DMW不可缓存窗口（TO_UNCACHE）访问，写入
+ *            旁路数据缓存，复位前无需缓存清理
+ *          - magic最后写入并带payload校验和，半截记录在下次
+ *            启动校验时被丢弃
+ *
+ * @note MISRA-C:2012 合规
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#define KLOG_TAG "crashdump"
+
+/*************************** 头文件包含 ****************************/
+#include <adrspace.h>
+#include <arch/loongarch64/backtrace.h>
+#include <arch/loongarch64/crashdump.h>
+#include <barrier.h>
+#include <cpu.h>
+#include <klog-ring.h>
+#include <klog.h>
+#include <stddef.h>
+#include <string.h>
+
+/*************************** 宏定义 ****************************/
+/* 记录头之后的payload容量（字节） */
+#define CRASHDUMP_PAYLOAD_MAX (CONFIG_CRASHDUMP_SIZE - sizeof(struct crashdump_header))
+
+/*************************** 类型定义 ****************************/
+
+/*************************** 外部声明 ****************************/
+
+/*************************** 前向声明 ****************************/
+static u32 crashdump_checksum(const void *buf, u32 len);
+
+/*************************** 模块变量 ****************************/
+/* 保留区不可缓存访问基址（init建立，save使用） */
+static volatile struct crashdump_header *s_crash_hdr = NULL;
+
+/* 首写独占标志：多核同时panic时仅第一个CPU执行写入 */
+static volatile u32 s_crash_claimed = 0U;
+
+/*************************** 函数实现 ****************************/
+
+/**
+ * @brief 计算payload的32位累加校验和
+ *
+ * @param buf 数据起始地址
+ * @param len 数据长度（字节）
+ *
+ * @return 32位累加校验和
+ */
+static u32 crashdump_checksum(const void *buf, u32 len)
+{
+    const u8 *p = (const u8 *)buf;
+    u32 sum = 0U;
+    u32 i;
+
+    for (i = 0U; i < len; i++)
+    {
+        sum += (u32)p[i];
+    }
+
+    return sum;
+}
+
+/**
+ * @brief 崩溃快存初始化
+ *
+ * @details 经DMW不可缓存窗口建立保留区访问基址；校验上次运行
+ *          留下的记录，完整则日志提示离线提取，记录保留到
+ *          下次崩溃写入时覆盖
+ *
+ * @return 无
+ *
+ * @note 应在启动阶段（单核）调用一次
+ */
+void crashdump_init(void)
+{
+    volatile struct crashdump_header *hdr;
+    const void *payload;
+    u32 sum;
+
+    hdr = (volatile struct crashdump_header *)TO_UNCACHE(CONFIG_CRASHDUMP_PHYS_BASE);
+    s_crash_hdr = hdr;
+
+    if ((hdr->magic != (u64)CRASHDUMP_MAGIC) || (hdr->version != CRASHDUMP_VERSION))
+    {
+        return;
+    }
+    if (hdr->payload_len > (u32)CRASHDUMP_PAYLOAD_MAX)
+    {
+        return;
+    }
+
+    /* 校验和不符视为半截记录，静默丢弃 */
+    payload = (const void *)&hdr[1];
+    sum = crashdump_checksum(payload, hdr->payload_len);
+    if (sum != hdr->checksum)
+    {
+        return;
+    }
+
+    KLOG_W("previous crash record present (cpu %u, %u bytes)\n", hdr->cpu, hdr->payload_len);
+}
+
+/**
+ * @brief 持久化崩溃现场
+ *
+ * @details 依次写入异常上下文、回溯地址快照和klog环缓冲原始
+ *          字节，最后写校验和与magic；仅第一个进入的CPU执行
+ *          写入，后续CPU直接返回
+ *
+ * @param context 异常上下文指针（不能为NULL）
+ *
+ * @return 无
+ *
+ * @note 仅限不可恢复错误路径调用（关中断上下文安全）
+ */
+void crashdump_save(const arch_exception_context_t *context)
+{
+    volatile struct crashdump_header *hdr = s_crash_hdr;
+    char *payload;
+    uintptr_t bt[CRASHDUMP_BT_MAX];
+    u32 bt_count;
+    u32 off = 0U;
+    u32 klog_len;
+
+    if (hdr == NULL)
+    {
+        return;
+    }
+
+    /* 首写独占：并发panic时后到的CPU不覆盖第一现场 */
+    if (__sync_lock_test_and_set(&s_crash_claimed, 1U) != 0U)
+    {
+        return;
+    }
+
+    /* 半截防护：先作废旧记录，payload写完再落magic */
+    hdr->magic = 0U;
+    smp_wmb();
+
+    payload = (char *)&hdr[1];
+
+    /* 异常上下文 */
+    memcpy(&payload[off], context, sizeof(struct arch_context));
+    off += (u32)sizeof(struct arch_context);
+
+    /* 回溯地址快照：崩溃点PC打头，内核侧帧链随后 */
+    bt[0] = (uintptr_t)context->csr_era;
+    bt_count = 1U + backtrace_capture(&bt[1], CRASHDUMP_BT_MAX - 1U);
+    memcpy(&payload[off], bt, sizeof(bt));
+    off += (u32)sizeof(bt);
+
+    /* klog环缓冲原始字节（按剩余容量截断） */
+    klog_len = klog_ring_snapshot(&payload[off], (u32)CRASHDUMP_PAYLOAD_MAX - off);
+    off += klog_len;
+
+    hdr->version = CRASHDUMP_VERSION;
+    hdr->cpu = csr_read32(LOONGARCH_CSR_CPUID);
+    hdr->tsc = drdtime();
+    hdr->bt_count = bt_count;
+    hdr->klog_len = klog_len;
+    hdr->payload_len = off;
+    hdr->checksum = crashdump_checksum(payload, off);
+
+    /* payload与头部字段全部落盘后再写magic，记录原子可见 */
+    smp_wmb();
+    hdr->magic = (u64)CRASHDUMP_MAGIC;
+    smp_wmb();
+}
@@ -0,0 +1,53 @@
+/**
+ * @file    current.c
+ * @brief   per-CPU当前任务指针快速访问实现
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件定义per-CPU当前任务指针与核号缓存
+ *          - 变量实体位于per-CPU数据段，各核经$r21偏移一条load
+ *            访问，消除调度热路径上的CSR读取与查表
+ *          - 核号在各核启动阶段缓存一次，此后不变
+ *
+ * @note MISRA-C:2012 合规
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+/*************************** 头文件包含 ****************************/
+#include <cpu.h>
+#include <current.h>
+#include <percpu.h>
+#include <stddef.h>
+
+/*************************** 宏定义 ****************************/
+
+
+/*************************** 数据结构 ****************************/
+
+
+/*************************** 模块变量 ****************************/
+/* 本核当前运行任务指针（调度器切换时更新） */
+DEFINE_PER_CPU(void *, arch_current_task);
+
+/* 本核核号缓存（启动时写入一次，替代CSR读取） */
+DEFINE_PER_CPU(u32, arch_cpu_id);
+
+/*************************** 函数实现 ****************************/
+
+/**
+ * @brief 初始化本核per-CPU快速访问数据
+ *
+ * @details 读一次LOONGARCH_CSR_CPUID缓存到per-CPU区，
+ *          清空当前任务指针；每核启动阶段调用一次
+ *
+ * @note 须在$r21（per-CPU基址）建立之后调用
+ */
+void arch_current_init(void)
+{
+    u32 cpu = cpuid_get();
+
+    per_cpu(arch_cpu_id, cpu) = cpu;
+    per_cpu(arch_current_task, cpu) = NULL;
+}
@@ -0,0 +1,57 @@
+/**
+ * @file    exc_stack.c
+ * @brief   每核专用异常/中断栈实现
+ * @author  Intewell Team
+ * @date    2025-08-29
+ * @version 1.0
+ *
+ * @details 本文件实现每核专用异常/中断栈的初始化
+ *          - 栈体静态分配、4KB对齐，启动期逐页预触碰建立
+ *            TLB映射并拉入缓存
+ *          - 栈顶写入EXCEPTION_KS2，中断入口一条csrrd完成
+ *            栈切换，深调用链任务接到中断不再踩冷页
+ *
+ * @note MISRA-C:2012 合规
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+/*************************** 头文件包含 ****************************/
+#include <cpu.h>
+#include <exc-stack.h>
+#include <percpu.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <system/types.h>
+
+/*************************** 模块变量 ****************************/
+/* 每核异常/中断栈体（4KB对齐，栈顶即缓存行对齐的帧起点） */
+static u8 s_exc_stack[CONFIG_MAX_CPUS][EXC_STACK_SIZE]
+    __attribute__((aligned(EXC_STACK_ALIGN)));
+
+/*************************** 函数实现 ****************************/
+
+/**
+ * @brief 初始化本核异常栈
+ *
+ * @details 逐页预触碰栈体，随后把栈顶写入EXCEPTION_KS2；
+ *          此后本核中断入口经一条csrrd取得栈顶切换压帧
+ *
+ * @note 每个核在本核初始化阶段各调用一次；
+ *       写入前KSave为零，入口栈切换判空跳过
+ */
+void exc_stack_init(void)
+{
+    u32 cpu = cpuid_get();
+    u8 *base = &s_exc_stack[cpu][0];
+    size_t offset;
+
+    /* 启动期逐页预触碰，消除首次进中断触页的TLB/缓存缺失 */
+    for (offset = 0U; offset < (size_t)EXC_STACK_SIZE; offset += (size_t)EXC_STACK_ALIGN)
+    {
+        *(volatile u8 *)(base + offset) = 0U;
+    }
+
+    /* 栈顶常驻KSave，入口一条csrrd即完成栈切换 */
+    csr_write64((u64)(uintptr_t)(base + EXC_STACK_SIZE), EXCEPTION_KS2);
+}
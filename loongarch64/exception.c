@@ -21,11 +21,20 @@
 /*************************** 头文件包含 ****************************/
 #include "ttosMM.h"
 
+#include <arch-bitops.h>
+#include <asm-extable.h>
 #include <barrier.h>
 #include <context.h>
+#include <cpu-features.h>
 #include <cpu.h>
+#include <crashdump.h>
+#include <errno.h>
 #include <exception.h>
+#include <fpu-lazy.h>
 #include <inttypes.h>
+#include <irqstat.h>
+#include <kbench.h>
+#include <klog-ring.h>
 #include <math.h>
 #include <process_signal.h>
 #include <ptrace/ptrace.h>
@@ -40,6 +49,7 @@
 #include <ttosProcess.h>
 #include <ttos_pic.h>
 #include <uaccess.h>
+#include <work-pending.h>
 
 #include <ttosInterTask.inl>
 #define KLOG_LEVEL KLOG_INFO
@@ -92,6 +102,68 @@ void *exception_table[EXCCODE_INT_START] = {
     [EXCCODE_WATCH] = handle_watch,        /**< 观察点异常 */
     [EXCCODE_BTDIS] = handle_lbt,          /**< LBT禁用异常 */
 };
+
+/* 按中断线向量化的直达入口（exception.S中由BUILD_VINT_HANDLER生成） */
+extern void handle_vint_0(void);
+extern void handle_vint_1(void);
+extern void handle_vint_2(void);
+extern void handle_vint_3(void);
+extern void handle_vint_4(void);
+extern void handle_vint_5(void);
+extern void handle_vint_6(void);
+extern void handle_vint_7(void);
+extern void handle_vint_8(void);
+extern void handle_vint_9(void);
+extern void handle_vint_10(void);
+extern void handle_vint_11(void);
+extern void handle_vint_12(void);
+extern void handle_vint_13(void);
+extern void handle_vint_14(void);
+
+/**
+ * @brief 向量化中断直达入口表
+ *
+ * @details 每条CPU中断线对应一个带编译期常量线号的汇编入口，
+ *          硬件按ECFG.VS直接落入对应向量槽
+ */
+static void *const vint_entry_table[EXCCODE_INT_NUM] = {
+    handle_vint_0,  handle_vint_1,  handle_vint_2,  handle_vint_3,
+    handle_vint_4,  handle_vint_5,  handle_vint_6,  handle_vint_7,
+    handle_vint_8,  handle_vint_9,  handle_vint_10, handle_vint_11,
+    handle_vint_12, handle_vint_13, handle_vint_14,
+};
+
+/**
+ * @brief 中断线直达处理注册项
+ */
+struct vint_direct
+{
+    void (*handler)(uint32_t irq, void *arg); /**< @brief 直达处理函数 */
+    void *arg;                                /**< @brief 处理函数私有参数 */
+};
+
+/* 各中断线的直达处理注册表：handler为NULL的线路回退到do_irq原路径 */
+static struct vint_direct s_vint_direct[EXCCODE_INT_NUM];
+
+/* 低延迟中断优先组掩码（按ESTAT.IS位布局）：组内挂起线路在一次陷入内批量收割 */
+static u32 s_vint_prio_group = 0U;
+
+/**
+ * @brief 定位挂起掩码中的最高优先级中断线
+ *
+ * @details 以clz.w单条指令定位最高挂起位（与cpuUtilsALib.S中
+ *          zeroNumOfWordGet同一思路），替代逐位比较扫描；
+ *          LoongArch中断线号越大优先级越高（IPI > TI > HWI）
+ *
+ * @param pending 挂起位掩码（调用方保证非0）
+ *
+ * @return 最高挂起位对应的中断线号
+ */
+static inline u32 vint_pending_msb(u32 pending)
+{
+    return 31U - arch_clz32(pending);
+}
+
 void local_flush_icache_range(unsigned long start, unsigned long end);
 /**
  * @brief 安装CPU异常处理函数
@@ -203,10 +275,10 @@ void exception_init(void)
 void trap_init(void)
 {
     long i;
-    /* 设置中断向量处理函数 */
+    /* 设置中断向量处理函数：每条中断线安装带常量线号的直达入口 */
     for (i = EXCCODE_INT_START; i <= EXCCODE_INT_END; i++)
     {
-        set_handler((unsigned long)i * VECSIZE, handle_vint, VECSIZE);
+        set_handler((unsigned long)i * VECSIZE, vint_entry_table[i - EXCCODE_INT_START], VECSIZE);
     }
     /* 设置异常向量处理函数 */
     for (i = EXCCODE_ADE; i <= EXCCODE_BTDIS; i++)
@@ -343,6 +415,34 @@ static void save_exce_context(pcb_t pcb, struct arch_context *context)
 }
 void do_work_pending(void *exp_frame);
 void restore_hw_debug(pcb_t pcb);
+/**
+ * @brief 返回用户态前的统一工作分发
+ *
+ * @details 一次load取得本核待处理工作位图后按位分发：
+ *          信号投递/重调度进入do_work_pending，调试位命中
+ *          且进程被跟踪时恢复硬件调试寄存器；快速退出未
+ *          开启时位图恒为全位，各工作项保守执行，行为与
+ *          原先逐项取数判断的串行路径一致
+ *
+ * @param context 异常/中断上下文指针（调用方保证有效）
+ *
+ * @note 性能关键路径：仅在确认从用户态进入后调用
+ */
+static void exit_to_user_work(void *context)
+{
+    pcb_t pcb_local = ttosProcessSelf();
+    u32 work = arch_work_pending_test();
+
+    if ((work & (ARCH_WORK_SIGPENDING | ARCH_WORK_RESCHED)) != 0U)
+    {
+        do_work_pending(context);
+    }
+    if (((work & ARCH_WORK_DEBUG_RESTORE) != 0U) && (pcb_local->group_leader->ptrace != 0))
+    {
+        restore_hw_debug(pcb_local->group_leader);
+    }
+    TTOS_TaskEnterUserHook(pcb_local->taskControlId);
+}
 /**
  * @brief 中断处理函数
  *
@@ -366,6 +466,8 @@ void do_irq(arch_int_context_t *context)
     u32 irq = 0U;
     s32 cpuid = 0;
     struct ttos_pic *pic_node;
+    u64 stat_t0 = 0U;
+    u64 bench_entry = kbench_irq_entry();
     TASK_ID task = ttosGetRunningTask();
     pcb_t pcb = NULL;
     /* 如果是从用户态进入，保存异常上下文 */
@@ -383,11 +485,16 @@ void do_irq(arch_int_context_t *context)
         while (pic_node->pic_ops->pic_ack(pic_node, &from_cpu, &irq) == 0)
         {
             TRACING_EVENT_ENTER(isr, irq, from_cpu);
+            /* 基准测量：do_irq入口到首次handler分发的延迟 */
+            kbench_irq_dispatch(bench_entry);
+            bench_entry = 0U;
             /* 增加中断嵌套层级 */
             ttosDisableScheduleLevel[cpuid]++;
             intNestLevel[cpuid]++;
-            /* 调用中断处理函数 */
+            /* 调用中断处理函数，按中断号记录次数与耗时 */
+            stat_t0 = drdtime();
             ttos_pic_irq_handle(irq);
+            irqstat_irq_record((u32)cpuid, irq, drdtime() - stat_t0);
             /* 发送中断结束信号 */
             pic_node->pic_ops->pic_eoi(pic_node, irq, from_cpu);
             /* 减少中断嵌套层级 */
@@ -402,13 +509,149 @@ void do_irq(arch_int_context_t *context)
     /* 返回用户态前的处理 */
     if (is_user_mode(context))
     {
-        pcb_t pcb_local = ttosProcessSelf();
-        do_work_pending(context);
-        if (pcb_local->group_leader->ptrace)
+        exit_to_user_work(context);
+    }
+}
+/**
+ * @brief 注册中断线直达处理函数
+ *
+ * @details 注册后该中断线经向量化入口直接调用处理函数，
+ *          跳过公共分发层的pic_ack扫描链
+ *
+ * @param line    CPU中断线号（0 ~ EXCCODE_INT_NUM-1）
+ * @param handler 直达处理函数（不能为NULL）
+ * @param arg     处理函数私有参数
+ *
+ * @return 成功返回0，参数非法返回-EINVAL
+ *
+ * @note 直达处理函数须自行完成本线路的设备级应答/清中断
+ *       （如定时器写TINTCLR、IPI读清状态寄存器）
+ */
+s32 vint_direct_install(u32 line, void (*handler)(uint32_t irq, void *arg), void *arg)
+{
+    if ((line >= EXCCODE_INT_NUM) || (handler == NULL))
+    {
+        return -EINVAL;
+    }
+
+    /* 先发布参数，再发布处理函数，分发侧以函数指针为就绪标志 */
+    s_vint_direct[line].arg = arg;
+    smp_wmb();
+    s_vint_direct[line].handler = handler;
+
+    return 0;
+}
+/**
+ * @brief 配置低延迟中断优先组
+ *
+ * @details 组内任一线路触发陷入时，分发侧读取一次ESTAT并以
+ *          位扫描批量收割组内其余挂起线路，多个同组中断共享
+ *          一次SAVE_ALL/ertn往返，降低中断调度抖动；组内未
+ *          注册直达处理的线路被跳过，留待其自身向量入口处理
+ *
+ * @param mask 优先组掩码（按ESTAT.IS位布局，如时钟/IPI）
+ *
+ * @return 成功返回0，掩码超出ESTAT.IS范围返回-EINVAL
+ *
+ * @note 应在启动期配置完毕，运行期只读
+ */
+s32 vint_priority_group_set(u32 mask)
+{
+    if ((mask & ~(u32)CSR_ESTAT_IS) != 0U)
+    {
+        return -EINVAL;
+    }
+
+    s_vint_prio_group = mask;
+    smp_wmb();
+
+    return 0;
+}
+/**
+ * @brief 向量化中断直达分发函数
+ *
+ * @details 中断线号由向量化入口以编译期常量传入，已注册直达
+ *          处理的线路走最短路径：嵌套计数、直接调用处理函数、
+ *          调度与返回用户态处理，省去pic_ack扫描与逐位判断链；
+ *          未注册的线路回退到do_irq原路径，行为完全不变
+ *
+ * @param context 中断上下文指针（不能为NULL）
+ * @param line    CPU中断线号（编译期常量，0 ~ EXCCODE_INT_NUM-1）
+ *
+ * @return 无
+ *
+ * @note 由exception.S的handle_vint_<line>入口调用
+ */
+void do_vint(arch_int_context_t *context, u32 line)
+{
+    s32 cpuid;
+    u64 stat_t0;
+    u32 pending;
+    const struct vint_direct *vd = &s_vint_direct[line];
+    u64 bench_entry;
+    TASK_ID task;
+    pcb_t pcb = NULL;
+
+    /* 未注册直达处理的线路回退到公共分发路径 */
+    if (vd->handler == NULL)
+    {
+        do_irq(context);
+
+        return;
+    }
+
+    bench_entry = kbench_irq_entry();
+    task = ttosGetRunningTask();
+    /* 如果是从用户态进入，保存异常上下文 */
+    if (is_user_mode(context) && (task != NULL) && (task->ppcb != NULL))
+    {
+        pcb = (pcb_t)task->ppcb;
+        save_exce_context(pcb, context);
+        TTOS_TaskEnterKernelHook(task);
+    }
+    cpuid = cpuid_get();
+    TRACING_EVENT_ENTER(isr, line, (u32)cpuid);
+    /* 基准测量：入口到handler分发的延迟 */
+    kbench_irq_dispatch(bench_entry);
+    /* 增加中断嵌套层级 */
+    ttosDisableScheduleLevel[cpuid]++;
+    intNestLevel[cpuid]++;
+    /* 直达调用处理函数，按中断线记录次数与耗时 */
+    stat_t0 = drdtime();
+    vd->handler(line, vd->arg);
+    irqstat_irq_record((u32)cpuid, line, drdtime() - stat_t0);
+    TRACING_EVENT_EXIT(isr, line);
+    /* 批量收割：同优先组内其余挂起线路在本次陷入内一并处理，
+     * clz从高位向低位定位（线号越大优先级越高），省去逐位比较
+     * 与多次SAVE_ALL/ertn往返 */
+    pending = read_csr_estat() & (u32)CSR_ESTAT_IS & s_vint_prio_group & ~(1U << line);
+    while (pending != 0U)
+    {
+        u32 next = vint_pending_msb(pending);
+        const struct vint_direct *vn = &s_vint_direct[next];
+
+        pending &= ~(1U << next);
+        /* 组内未注册直达处理的线路留待其自身向量入口处理 */
+        if (vn->handler == NULL)
         {
-            restore_hw_debug(pcb_local->group_leader);
+            continue;
         }
-        TTOS_TaskEnterUserHook(pcb_local->taskControlId);
+        TRACING_EVENT_ENTER(isr, next, (u32)cpuid);
+        stat_t0 = drdtime();
+        vn->handler(next, vn->arg);
+        irqstat_irq_record((u32)cpuid, next, drdtime() - stat_t0);
+        TRACING_EVENT_EXIT(isr, next);
+    }
+    /* 减少中断嵌套层级 */
+    intNestLevel[cpuid]--;
+    ttosDisableScheduleLevel[cpuid]--;
+    /* 触发任务调度 */
+    ttosSchedule();
+    set_context_type(context, IRQ_CONTEXT);
+    /* 返回用户态前的处理 */
+    if (is_user_mode(context))
+    {
+        exit_to_user_work(context);
     }
 }
 /**
@@ -434,6 +677,7 @@ void do_irq(arch_int_context_t *context)
 void do_syscall(arch_exception_context_t *context)
 {
     register unsigned long sp __asm__("$sp");
+    u64 stat_t0 = drdtime();
     int64_t ret = 0;
     int32_t syscall_num = 0;
     TASK_ID task = ttosGetRunningTask();
@@ -468,6 +712,8 @@ void do_syscall(arch_exception_context_t *context)
                                                     context->regs[7], context->regs[8], context->regs[9]);
         }
         context->regs[4] = (uint64_t)ret;
+        irqstat_syscall_record((u32)cpuid_get(), drdtime() - stat_t0);
+
         return;
     }
     /* 处理标准系统调用 */
@@ -496,16 +742,11 @@ void do_syscall(arch_exception_context_t *context)
             KLOG_E("syscall_table[%d] is NULL\n", syscall_num);
         }
     }
+    irqstat_syscall_record((u32)cpuid_get(), drdtime() - stat_t0);
     /* 返回用户态前的处理 */
     if (is_user_mode(context))
     {
-        pcb_t pcb_local = ttosProcessSelf();
-        do_work_pending(context);
-        if (pcb_local->group_leader->ptrace)
-        {
-            restore_hw_debug(pcb_local->group_leader);
-        }
-        TTOS_TaskEnterUserHook(pcb_local->taskControlId);
+        exit_to_user_work(context);
     }
 }
 /**
@@ -527,6 +768,13 @@ void do_exception(arch_exception_context_t *context)
     long Ecode = (long)((context->csr_estat & ((0x3fL) << 16)) >> 16);
     long EsubCode = (long)((context->csr_estat & ((0x1ffL) << 22)) >> 22);
     long badins = (long)csr_read64(LOONGARCH_CSR_BADI);
+    /* 致命异常不再返回，只记次数供事后取证 */
+    irqstat_exc_record((u32)cpuid_get(), (u32)Ecode, 0U);
+    /* 崩溃快存：毫秒级把现场写入保留内存，此后看门狗可随时复位，
+     * 下方的慢速串口输出仅为有人值守时的现场可读性保留 */
+    crashdump_save(context);
+    /* 同步转储环形缓冲中的残留日志，保留崩溃前的诊断现场 */
+    klog_ring_panic_dump();
     KLOG_EMERG("================Kernel Exception================");
     KLOG_EMERG("CPUID: %u, TaskID: %p", csr_read32(LOONGARCH_CSR_CPUID), ttosGetRunningTask());
     KLOG_EMERG("RegMap:");
@@ -560,6 +808,16 @@ void do_exception(arch_exception_context_t *context)
  */
 void do_ade(arch_exception_context_t *context)
 {
+    u64 stat_t0 = drdtime();
+
+    /* 内核态访问用户空间出错：查异常修复表，命中则回填后继续执行 */
+    if (fixup_exception(context))
+    {
+        irqstat_exc_record((u32)cpuid_get(), EXCCODE_ADE, drdtime() - stat_t0);
+
+        return;
+    }
+
     KLOG_EMERG("Ade exception");
     do_exception(context);
 }
@@ -576,6 +834,16 @@ void do_ade(arch_exception_context_t *context)
  */
 void do_ale(arch_exception_context_t *context)
 {
+    u64 stat_t0 = drdtime();
+
+    /* 被修复表覆盖的用户空间访问同样允许从对齐错误中恢复 */
+    if (fixup_exception(context))
+    {
+        irqstat_exc_record((u32)cpuid_get(), EXCCODE_ALE, drdtime() - stat_t0);
+
+        return;
+    }
+
     KLOG_EMERG("Ale exception");
     do_exception(context);
 }
@@ -616,12 +884,21 @@ void do_bp(arch_exception_context_t *context)
  *
  * @param context 异常上下文指针（不能为NULL）
  *
- * @return 无（此函数不会返回）
+ * @return 无
  *
- * @note 通常需要在此处启用FPU并恢复执行
+ * @note 惰性切换：首次使用FPU时在此打开使能位并换入任务的浮点状态
  */
 void do_fpu(arch_exception_context_t *context)
 {
+    TASK_ID task = ttosGetRunningTask();
+
+    if (cpu_has_fpu && (task != NULL))
+    {
+        lazy_fpu_own(task, CSR_EUEN_FPEN);
+
+        return;
+    }
+
     KLOG_EMERG("Fpu exception");
     do_exception(context);
 }
@@ -648,10 +925,22 @@ void do_fpe(arch_exception_context_t *context)
  *
  * @param context 异常上下文指针（不能为NULL）
  *
- * @return 无（此函数不会返回）
+ * @return 无
+ *
+ * @note 惰性切换：首次使用LSX时在此打开使能位并换入任务的向量状态
+ * @note LSX状态包含FPU状态，同时打开FPEN
  */
 void do_lsx(arch_exception_context_t *context)
 {
+    TASK_ID task = ttosGetRunningTask();
+
+    if (cpu_has_lsx && (task != NULL))
+    {
+        lazy_fpu_own(task, CSR_EUEN_FPEN | CSR_EUEN_LSXEN);
+
+        return;
+    }
+
     KLOG_EMERG("Lsx exception");
     do_exception(context);
 }
@@ -662,10 +951,22 @@ void do_lsx(arch_exception_context_t *context)
  *
  * @param context 异常上下文指针（不能为NULL）
  *
- * @return 无（此函数不会返回）
+ * @return 无
+ *
+ * @note 惰性切换：首次使用LASX时在此打开使能位并换入任务的向量状态
+ * @note LASX状态包含LSX和FPU状态，同时打开FPEN与LSXEN
  */
 void do_lasx(arch_exception_context_t *context)
 {
+    TASK_ID task = ttosGetRunningTask();
+
+    if (cpu_has_lasx && (task != NULL))
+    {
+        lazy_fpu_own(task, CSR_EUEN_FPEN | CSR_EUEN_LSXEN | CSR_EUEN_LASXEN);
+
+        return;
+    }
+
     KLOG_EMERG("Lasx exception");
     do_exception(context);
 }
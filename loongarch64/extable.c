@@ -0,0 +1,145 @@
+/**
+ * @file    extable.c
+ * @brief   LoongArch64异常修复表处理
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件实现异常修复表（exception table）的查找和修复
+ *          - 内核态访问用户空间出错时按csr_era查表
+ *          - EX_TYPE_FIXUP：直接跳转到修复地址
+ *          - EX_TYPE_UACCESS_ERR_ZERO：回填错误码和零值后跳转
+ *
+ * @note MISRA-C:2012 合规
+ * @note 修复表条目由asm-extable.h中的宏发射，链接到__ex_table段
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+/*************************** 头文件包含 ****************************/
+#include <asm-extable.h>
+#include <cpu.h>
+#include <errno.h>
+#include <exception.h>
+#include <stdbool.h>
+#include <ttos_arch.h>
+
+/*************************** 宏定义 ****************************/
+
+/*************************** 类型定义 ****************************/
+
+/*************************** 外部声明 ****************************/
+/* 链接脚本提供的修复表边界 */
+extern struct exception_table_entry __start___ex_table[];
+extern struct exception_table_entry __stop___ex_table[];
+
+/*************************** 前向声明 ****************************/
+
+/*************************** 模块变量 ****************************/
+
+/*************************** 函数实现 ****************************/
+
+/**
+ * @brief 取出条目对应的出错指令地址
+ *
+ * @param ex 异常表条目
+ *
+ * @return 出错指令的绝对地址
+ */
+static inline unsigned long ex_insn_addr(const struct exception_table_entry *ex)
+{
+    return (unsigned long)&ex->insn + (unsigned long)(long)ex->insn;
+}
+
+/**
+ * @brief 取出条目对应的修复跳转地址
+ *
+ * @param ex 异常表条目
+ *
+ * @return 修复代码的绝对地址
+ */
+static inline unsigned long ex_fixup_addr(const struct exception_table_entry *ex)
+{
+    return (unsigned long)&ex->fixup + (unsigned long)(long)ex->fixup;
+}
+
+/**
+ * @brief 写入异常上下文中的通用寄存器
+ *
+ * @details 寄存器编号0为硬件零寄存器，写入被忽略
+ *
+ * @param regs 异常上下文
+ * @param num 寄存器编号（0-31）
+ * @param value 写入值
+ *
+ * @return 无
+ */
+static void regs_set_gpr(struct arch_context *regs, unsigned int num, unsigned long value)
+{
+    if ((num != 0U) && (num < 32U))
+    {
+        regs->regs[num] = value;
+    }
+}
+
+/**
+ * @brief 执行用户访问类修复
+ *
+ * @details 错误寄存器写入-EFAULT，目标寄存器清零，
+ *          然后跳转到修复地址继续执行
+ *
+ * @param ex 异常表条目
+ * @param regs 异常上下文
+ *
+ * @return 固定返回true
+ */
+static bool ex_handler_uaccess_err_zero(const struct exception_table_entry *ex, struct arch_context *regs)
+{
+    unsigned int reg_err = ((unsigned int)ex->data & EX_DATA_REG_ERR) >> EX_DATA_REG_ERR_SHIFT;
+    unsigned int reg_zero = ((unsigned int)ex->data & EX_DATA_REG_ZERO) >> EX_DATA_REG_ZERO_SHIFT;
+
+    regs_set_gpr(regs, reg_err, (unsigned long)(long)-EFAULT);
+    regs_set_gpr(regs, reg_zero, 0UL);
+    regs->csr_era = ex_fixup_addr(ex);
+
+    return true;
+}
+
+/**
+ * @brief 异常表修复
+ *
+ * @details 线性查找与csr_era匹配的条目并按类型执行修复动作，
+ *          修复表仅覆盖内核态访问用户空间的指令，用户态异常
+ *          不会命中
+ *
+ * @param regs 异常上下文
+ *
+ * @return 命中并修复返回true，未命中返回false
+ */
+bool fixup_exception(struct arch_context *regs)
+{
+    const struct exception_table_entry *ex;
+
+    for (ex = __start___ex_table; ex < __stop___ex_table; ex++)
+    {
+        if (ex_insn_addr(ex) != regs->csr_era)
+        {
+            continue;
+        }
+        switch (ex->type)
+        {
+        case EX_TYPE_FIXUP:
+            regs->csr_era = ex_fixup_addr(ex);
+
+            return true;
+        case EX_TYPE_UACCESS_ERR_ZERO:
+
+            return ex_handler_uaccess_err_zero(ex, regs);
+        default:
+            /* 未知类型视作未命中，交由上层按致命异常处理 */
+            break;
+        }
+    }
+
+    return false;
+}
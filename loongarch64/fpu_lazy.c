@@ -0,0 +1,168 @@
+/**
+ * @file    fpu_lazy.c
+ * @brief   LoongArch64惰性FPU/LSX/LASX上下文切换实现
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件实现浮点/向量上下文的惰性切换
+ *          - 切出：按EUEN已使能的最宽单元保存状态，然后关断使能位
+ *          - 切入：不恢复任何状态，首次使用触发禁用异常时再换入
+ *          - per-CPU最后拥有者记录：同核往返且宽度足够时免恢复
+ *          - 不使用浮点的任务在整个切换路径上零额外开销
+ *
+ * @note MISRA-C:2012 合规
+ * @note 拥有者记录仅由本CPU在关中断上下文访问，无需加锁
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+/*************************** 头文件包含 ****************************/
+#include <cpu-features.h>
+#include <cpu.h>
+#include <fpu-lazy.h>
+#include <fpu.h>
+#include <stddef.h>
+#include <ttos.h>
+
+/*************************** 宏定义 ****************************/
+
+/*************************** 类型定义 ****************************/
+
+/*************************** 外部声明 ****************************/
+
+/*************************** 前向声明 ****************************/
+
+/*************************** 模块变量 ****************************/
+/* 本CPU浮点/向量寄存器组的最后拥有者（NULL表示无拥有者） */
+static TASK_ID s_fpu_owner[CONFIG_MAX_CPUS];
+
+/* 最后拥有者被保存时已使能的EUEN位，用于判断同核往返的宽度是否足够 */
+static unsigned int s_fpu_owner_euen[CONFIG_MAX_CPUS];
+
+/*************************** 函数实现 ****************************/
+
+/**
+ * @brief 按最宽已使能单元保存任务的浮点/向量状态
+ *
+ * @details LASX状态是LSX的超集，LSX状态是FPU的超集，
+ *          只需保存最宽一级即可覆盖全部已使用状态
+ *
+ * @param task 任务控制块指针
+ * @param euen 已使能的EUEN位
+ */
+static void lazy_fpu_save_widest(TASK_ID task, unsigned int euen)
+{
+    if ((euen & CSR_EUEN_LASXEN) != 0U)
+    {
+        save_lasx(task);
+    }
+    else if ((euen & CSR_EUEN_LSXEN) != 0U)
+    {
+        save_lsx(task);
+    }
+    else
+    {
+        save_fp(task);
+    }
+}
+
+/**
+ * @brief 按请求的最宽单元恢复任务的浮点/向量状态
+ *
+ * @param task 任务控制块指针
+ * @param euen_mask 请求打开的EUEN位
+ */
+static void lazy_fpu_restore_widest(TASK_ID task, unsigned int euen_mask)
+{
+    if ((euen_mask & CSR_EUEN_LASXEN) != 0U)
+    {
+        restore_lasx(task);
+    }
+    else if ((euen_mask & CSR_EUEN_LSXEN) != 0U)
+    {
+        restore_lsx(task);
+    }
+    else
+    {
+        restore_fp(task);
+    }
+}
+
+/**
+ * @brief 任务切出时的惰性浮点处理
+ *
+ * @details 读取EUEN判断任务本轮是否使用过浮点/向量单元：
+ *          未使用则直接返回（80%实时任务的零开销路径）；
+ *          使用过则按最宽已使能单元保存状态、记录拥有者并关断使能位
+ *
+ * @param task 切出任务的控制块指针（不能为NULL）
+ *
+ * @note 性能关键路径：调用方保证参数有效性
+ */
+void lazy_fpu_switch_out(TASK_ID task)
+{
+    unsigned int euen;
+    unsigned int cpu;
+
+    euen = csr_read32(LOONGARCH_CSR_EUEN) & LAZY_FPU_EUEN_MASK;
+    if (euen == 0U)
+    {
+        /* 任务本轮未触碰浮点/向量单元，无需任何保存 */
+        return;
+    }
+
+    lazy_fpu_save_widest(task, euen);
+
+    cpu = (unsigned int)cpuid_get();
+    s_fpu_owner[cpu] = task;
+    s_fpu_owner_euen[cpu] = euen;
+
+    /* 关断使能位：下个任务首次使用时经禁用异常陷入换入 */
+    csr_xchg32(0U, LAZY_FPU_EUEN_MASK, LOONGARCH_CSR_EUEN);
+}
+
+/**
+ * @brief 首次使用陷入时的惰性浮点换入
+ *
+ * @details 打开请求的EUEN使能位后换入状态：
+ *          - 本CPU最后拥有者即当前任务且宽度足够：寄存器内容仍属
+ *            该任务，免恢复（同核往返快速路径）
+ *          - 拥有者是当前任务但请求更宽单元：先保存仍然鲜活的窄状态，
+ *            再按新宽度整体换入（高位部分来自任务上下文的初始值）
+ *          - 其他情况：从任务上下文换入请求宽度的状态
+ *
+ * @param task 当前任务的控制块指针（不能为NULL）
+ * @param euen_mask 请求打开的EUEN使能位（LAZY_FPU_EUEN_MASK的子集）
+ *
+ * @note 性能关键路径：调用方保证参数有效性
+ */
+void lazy_fpu_own(TASK_ID task, unsigned int euen_mask)
+{
+    unsigned int cpu = (unsigned int)cpuid_get();
+
+    /* 先打开使能位，保存/恢复指令才能执行 */
+    csr_xchg32(euen_mask, euen_mask, LOONGARCH_CSR_EUEN);
+
+    if (s_fpu_owner[cpu] == task)
+    {
+        if ((euen_mask & ~s_fpu_owner_euen[cpu]) == 0U)
+        {
+            /* 同核往返且宽度足够：寄存器内容未被他人使用，免恢复 */
+            s_fpu_owner_euen[cpu] |= euen_mask;
+
+            return;
+        }
+
+        /* 请求加宽：先落盘仍然鲜活的窄状态，再按新宽度整体换入 */
+        lazy_fpu_save_widest(task, s_fpu_owner_euen[cpu]);
+        lazy_fpu_restore_widest(task, euen_mask);
+        s_fpu_owner_euen[cpu] |= euen_mask;
+
+        return;
+    }
+
+    lazy_fpu_restore_widest(task, euen_mask);
+    s_fpu_owner[cpu] = task;
+    s_fpu_owner_euen[cpu] = euen_mask;
+}
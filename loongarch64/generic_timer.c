@@ -18,16 +18,21 @@
 
 /*************************** 头文件包含 ****************************/
 #include <barrier.h>
+#include <boot-trace.h>
 #include <clock/clockchip.h>
 #include <clock/clocksource.h>
 #include <cpu.h>
 #include <cpuid.h>
+#include <exception.h>
 #include <kmalloc.h>
+#include <kprofile.h>
+#include <smp-boot.h>
 #include <stdio.h>
 #include <string.h>
 #include <time/ktime.h>
 #include <ttos_pic.h>
 #include <ttos_time.h>
+#include <vdso-time.h>
 
 #undef DEBUG
 #ifdef DEBUG
@@ -140,6 +145,8 @@ int arch_timer_clocksource_init(void)
     generic_timer_shift = cs->shift;
     cs->priv = NULL;
 
+    boot_trace_mark("clocksource_init");
+
     return clocksource_register(cs);
 }
 
@@ -258,6 +265,13 @@ static void generic_phys_timer_handler(uint32_t irq, void *dev)
 
     /* Clear Timer Interrupt */
     write_csr_tintclear(CSR_TINTCLR_TI);
+
+    /* 采样剖析：未使能时仅一次分支开销 */
+    kprofile_timer_sample();
+
+    /* 刷新用户态共享取时页epoch（单写者：仅绑定核执行） */
+    vdso_time_update();
+
     cc->event_handler(cc);
 
     return;
@@ -312,7 +326,10 @@ static int generic_timer_startup(void)
         return -1;
     }
 
+    /* 校时写全局基准，从核并行启动时须全局串行执行 */
+    smp_boot_serial_begin();
     sync_counter();
+    smp_boot_serial_end();
 
     irq = ttos_core_pic_irq_alloc(LOONGARCH_TIMER_PHYS_IRQ);
 
@@ -328,6 +345,14 @@ static int generic_timer_startup(void)
     ttos_pic_irq_priority_set(irq, 0);
     ttos_pic_irq_unmask(irq);
 
+    /* 定时器中断走向量化直达路径：处理函数自行写TINTCLR清中断，
+     * 跳过公共分发层的pic_ack扫描 */
+    (void)vint_direct_install(INT_TI, generic_phys_timer_handler, cc);
+
+    /* 时钟/IPI归入低延迟优先组：同组挂起中断在一次陷入内批量
+     * 收割；IPI线路在其直达处理注册前会被安全跳过 */
+    (void)vint_priority_group_set((1U << INT_TI) | (1U << INT_IPI));
+
     return 0;
 }
 
@@ -355,5 +380,8 @@ int arch_timer_clockchip_init(void)
 
     generic_timer_startup();
 
+    /* 定时器系数就绪后建立用户态共享取时页 */
+    vdso_time_init();
+
     return 0;
 }
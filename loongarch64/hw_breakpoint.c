@@ -0,0 +1,398 @@
+/**
+ * @file    hw_breakpoint.c
+ * @brief   LoongArch64硬件断点/观察点引擎实现
+ * @author  Intewell Team
+ * @date    2025-08-29
+ * @version 1.0
+ *
+ * @details 本文件实现硬件调试寄存器的分配与上下文管理
+ *          - 取指断点/访存观察点的槽位分配器（状态存于PCB）
+ *          - 进程切换时按PCB状态恢复调试寄存器
+ *          - 硬件单步：保留最高取指断点组装全掩码断点，
+ *            任意取指地址命中，单步不触碰指令流与I-cache
+ *
+ * @note MISRA-C:2012 合规
+ * @note 槽位个数以FWPC/MWPC低6位上报值为准，引擎最多管理8组
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+/*************************** 头文件包含 ****************************/
+#include <cpu-info.h>
+#include <cpu.h>
+#include <errno.h>
+#include <hw-breakpoint.h>
+#include <io.h>
+#include <work-pending.h>
+
+/*************************** 宏定义 ****************************/
+
+/**
+ * @brief 取指断点组写入（组号为编译期常量，逐组展开）
+ */
+#define IB_SLOT_WRITE_CASE(n)                                  \
+    case n:                                                    \
+        csr_write64(addr, LOONGARCH_CSR_IB0ADDR + ((n) << 3)); \
+        csr_write64(mask, LOONGARCH_CSR_IB0MASK + ((n) << 3)); \
+        csr_write64(0UL, LOONGARCH_CSR_IB0ASID + ((n) << 3));  \
+        csr_write64(ctrl, LOONGARCH_CSR_IB0CTRL + ((n) << 3)); \
+        break
+
+/**
+ * @brief 访存观察点组写入（组号为编译期常量，逐组展开）
+ */
+#define DB_SLOT_WRITE_CASE(n)                                  \
+    case n:                                                    \
+        csr_write64(addr, LOONGARCH_CSR_DB0ADDR + ((n) << 3)); \
+        csr_write64(mask, LOONGARCH_CSR_DB0MASK + ((n) << 3)); \
+        csr_write64(0UL, LOONGARCH_CSR_DB0ASID + ((n) << 3));  \
+        csr_write64(ctrl, LOONGARCH_CSR_DB0CTRL + ((n) << 3)); \
+        break
+
+/*************************** 内部函数声明 ****************************/
+static void ib_slot_write(int n, uint64_t addr, uint64_t mask, uint64_t ctrl);
+static void db_slot_write(int n, uint64_t addr, uint64_t mask, uint64_t ctrl);
+static int hw_bp_slots(void);
+static int hw_wp_slots(void);
+
+/*************************** 函数实现 ****************************/
+/**
+ * @brief 写入一组取指断点寄存器
+ *
+ * @param n    组号（0起）
+ * @param addr 断点地址
+ * @param mask 地址掩码（置1的位不参与比较）
+ * @param ctrl 控制值（0为关闭）
+ */
+static void ib_slot_write(int n, uint64_t addr, uint64_t mask, uint64_t ctrl)
+{
+    switch (n)
+    {
+        IB_SLOT_WRITE_CASE(0);
+        IB_SLOT_WRITE_CASE(1);
+        IB_SLOT_WRITE_CASE(2);
+        IB_SLOT_WRITE_CASE(3);
+        IB_SLOT_WRITE_CASE(4);
+        IB_SLOT_WRITE_CASE(5);
+        IB_SLOT_WRITE_CASE(6);
+        IB_SLOT_WRITE_CASE(7);
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief 写入一组访存观察点寄存器
+ *
+ * @param n    组号（0起）
+ * @param addr 观察地址
+ * @param mask 地址掩码（置1的位不参与比较）
+ * @param ctrl 控制值（0为关闭）
+ */
+static void db_slot_write(int n, uint64_t addr, uint64_t mask, uint64_t ctrl)
+{
+    switch (n)
+    {
+        DB_SLOT_WRITE_CASE(0);
+        DB_SLOT_WRITE_CASE(1);
+        DB_SLOT_WRITE_CASE(2);
+        DB_SLOT_WRITE_CASE(3);
+        DB_SLOT_WRITE_CASE(4);
+        DB_SLOT_WRITE_CASE(5);
+        DB_SLOT_WRITE_CASE(6);
+        DB_SLOT_WRITE_CASE(7);
+    default:
+        break;
+    }
+}
+
+/**
+ * @brief 引擎管理的取指断点组数（硬件上报与上限取小）
+ *
+ * @return 可用组数
+ */
+static int hw_bp_slots(void)
+{
+    int n = get_num_brps();
+
+    return (n > HW_DBG_SLOT_MAX) ? HW_DBG_SLOT_MAX : n;
+}
+
+/**
+ * @brief 引擎管理的访存观察点组数（硬件上报与上限取小）
+ *
+ * @return 可用组数
+ */
+static int hw_wp_slots(void)
+{
+    int n = get_num_wrps();
+
+    return (n > HW_DBG_SLOT_MAX) ? HW_DBG_SLOT_MAX : n;
+}
+
+/**
+ * @brief 清除本核所有硬件断点与观察点
+ */
+void hw_debug_clear_all(void)
+{
+    int i;
+    int bp = hw_bp_slots();
+    int wp = hw_wp_slots();
+
+    for (i = 0; i < bp; i++)
+    {
+        ib_slot_write(i, 0UL, 0UL, 0UL);
+    }
+    for (i = 0; i < wp; i++)
+    {
+        db_slot_write(i, 0UL, 0UL, 0UL);
+    }
+
+    /* 清除残留的命中状态位图 */
+    csr_write64(0UL, LOONGARCH_CSR_FWPS);
+    csr_write64(0UL, LOONGARCH_CSR_MWPS);
+    barrier();
+}
+
+/**
+ * @brief 安装取指断点
+ *
+ * @param pcb  目标进程控制块
+ * @param addr 断点地址（指令地址，4字节对齐）
+ *
+ * @return 成功返回分配的组号，无空闲组返回-ENOSPC，参数非法返回-EINVAL
+ */
+s32 hw_breakpoint_install(pcb_t pcb, uintptr_t addr)
+{
+    int i;
+    /* 最高组保留给单步引擎，分配器只管理其余组 */
+    int limit = hw_bp_slots() - 1;
+
+    if ((pcb == NULL) || ((addr & 0x3U) != 0U))
+    {
+        return -EINVAL;
+    }
+
+    for (i = 0; i < limit; i++)
+    {
+        if (pcb->debug_state.bp.dbg_regs[i].ctrl == 0U)
+        {
+            pcb->debug_state.bp.dbg_regs[i].addr = addr;
+            pcb->debug_state.bp.dbg_regs[i].ctrl = HW_DBG_CTRL_PLV3_EN;
+            pcb->debug_state.bp_count++;
+            /* 被跟踪任务可能迁移，广播置位让各核返回路径恢复调试寄存器 */
+            arch_work_pending_set_all(ARCH_WORK_DEBUG_RESTORE);
+
+            return i;
+        }
+    }
+
+    return -ENOSPC;
+}
+
+/**
+ * @brief 移除取指断点
+ *
+ * @param pcb  目标进程控制块
+ * @param addr 安装时的断点地址
+ *
+ * @return 成功返回0，未找到返回-ENOENT，参数非法返回-EINVAL
+ */
+s32 hw_breakpoint_remove(pcb_t pcb, uintptr_t addr)
+{
+    int i;
+    int limit = hw_bp_slots() - 1;
+
+    if (pcb == NULL)
+    {
+        return -EINVAL;
+    }
+
+    for (i = 0; i < limit; i++)
+    {
+        if ((pcb->debug_state.bp.dbg_regs[i].ctrl != 0U) && (pcb->debug_state.bp.dbg_regs[i].addr == addr))
+        {
+            pcb->debug_state.bp.dbg_regs[i].addr = 0U;
+            pcb->debug_state.bp.dbg_regs[i].ctrl = 0U;
+            pcb->debug_state.bp_count--;
+
+            return 0;
+        }
+    }
+
+    return -ENOENT;
+}
+
+/**
+ * @brief 安装访存观察点
+ *
+ * @param pcb  目标进程控制块
+ * @param addr 观察地址
+ * @param type 访问类型（HW_WP_TYPE_READ/HW_WP_TYPE_WRITE可组合）
+ *
+ * @return 成功返回分配的组号，无空闲组返回-ENOSPC，参数非法返回-EINVAL
+ */
+s32 hw_watchpoint_install(pcb_t pcb, uintptr_t addr, u32 type)
+{
+    int i;
+    int limit = hw_wp_slots();
+    uint64_t ctrl = HW_DBG_CTRL_PLV3_EN;
+
+    if ((pcb == NULL) || ((type & (HW_WP_TYPE_READ | HW_WP_TYPE_WRITE)) == 0U))
+    {
+        return -EINVAL;
+    }
+    if ((type & HW_WP_TYPE_READ) != 0U)
+    {
+        ctrl |= HW_DBG_CTRL_LOAD_EN;
+    }
+    if ((type & HW_WP_TYPE_WRITE) != 0U)
+    {
+        ctrl |= HW_DBG_CTRL_STORE_EN;
+    }
+
+    for (i = 0; i < limit; i++)
+    {
+        if (pcb->debug_state.wr.dbg_regs[i].ctrl == 0U)
+        {
+            pcb->debug_state.wr.dbg_regs[i].addr = addr;
+            pcb->debug_state.wr.dbg_regs[i].ctrl = ctrl;
+            pcb->debug_state.wr_count++;
+            /* 同取指断点：广播置位调试恢复位 */
+            arch_work_pending_set_all(ARCH_WORK_DEBUG_RESTORE);
+
+            return i;
+        }
+    }
+
+    return -ENOSPC;
+}
+
+/**
+ * @brief 移除访存观察点
+ *
+ * @param pcb  目标进程控制块
+ * @param addr 安装时的观察地址
+ *
+ * @return 成功返回0，未找到返回-ENOENT，参数非法返回-EINVAL
+ */
+s32 hw_watchpoint_remove(pcb_t pcb, uintptr_t addr)
+{
+    int i;
+    int limit = hw_wp_slots();
+
+    if (pcb == NULL)
+    {
+        return -EINVAL;
+    }
+
+    for (i = 0; i < limit; i++)
+    {
+        if ((pcb->debug_state.wr.dbg_regs[i].ctrl != 0U) && (pcb->debug_state.wr.dbg_regs[i].addr == addr))
+        {
+            pcb->debug_state.wr.dbg_regs[i].addr = 0U;
+            pcb->debug_state.wr.dbg_regs[i].ctrl = 0U;
+            pcb->debug_state.wr_count--;
+
+            return 0;
+        }
+    }
+
+    return -ENOENT;
+}
+
+/**
+ * @brief 使能硬件单步
+ *
+ * @details 在保留的最高取指断点组记录全掩码断点：掩码全1使
+ *          任意取指地址命中，恢复执行一条指令即触发调试异常。
+ *          地址记为当前ERA仅作诊断用途，比较时被掩码全部屏蔽
+ *
+ * @param pcb 目标进程控制块
+ */
+void hw_single_step_enable(pcb_t pcb)
+{
+    int ss = hw_bp_slots() - 1;
+
+    if ((pcb == NULL) || (ss < 0))
+    {
+        return;
+    }
+
+    pcb->debug_state.bp.dbg_regs[ss].addr = pcb->exception_context.csr_era;
+    pcb->debug_state.bp.dbg_regs[ss].ctrl = HW_DBG_CTRL_PLV3_EN;
+    /* 单步恢复执行前各核返回路径需要写入单步断点组 */
+    arch_work_pending_set_all(ARCH_WORK_DEBUG_RESTORE);
+}
+
+/**
+ * @brief 关闭硬件单步
+ *
+ * @param pcb 目标进程控制块
+ */
+void hw_single_step_disable(pcb_t pcb)
+{
+    int ss = hw_bp_slots() - 1;
+
+    if ((pcb == NULL) || (ss < 0))
+    {
+        return;
+    }
+
+    pcb->debug_state.bp.dbg_regs[ss].addr = 0U;
+    pcb->debug_state.bp.dbg_regs[ss].ctrl = 0U;
+}
+
+/**
+ * @brief 把进程的调试状态写入硬件
+ *
+ * @details 逐组写入地址/掩码/控制寄存器，未使用的组显式关闭，
+ *          保证不残留上一个被调试进程的断点；单步保留组写入
+ *          全1掩码，其余组精确匹配
+ *
+ * @param pcb 目标进程控制块
+ */
+void hw_debug_restore(pcb_t pcb)
+{
+    int i;
+    int bp = hw_bp_slots();
+    int wp = hw_wp_slots();
+
+    if (pcb == NULL)
+    {
+        return;
+    }
+
+    for (i = 0; i < bp; i++)
+    {
+        uint64_t ctrl = pcb->debug_state.bp.dbg_regs[i].ctrl;
+        uint64_t mask = (i == (bp - 1)) ? ~0UL : 0UL;
+
+        if (ctrl != 0U)
+        {
+            ib_slot_write(i, pcb->debug_state.bp.dbg_regs[i].addr, mask, ctrl);
+        }
+        else
+        {
+            ib_slot_write(i, 0UL, 0UL, 0UL);
+        }
+    }
+    for (i = 0; i < wp; i++)
+    {
+        uint64_t ctrl = pcb->debug_state.wr.dbg_regs[i].ctrl;
+
+        if (ctrl != 0U)
+        {
+            db_slot_write(i, pcb->debug_state.wr.dbg_regs[i].addr, 0UL, ctrl);
+        }
+        else
+        {
+            db_slot_write(i, 0UL, 0UL, 0UL);
+        }
+    }
+
+    /* 清除命中状态，避免恢复后立即误报 */
+    csr_write64(0UL, LOONGARCH_CSR_FWPS);
+    csr_write64(0UL, LOONGARCH_CSR_MWPS);
+    barrier();
+}
@@ -17,25 +17,137 @@
  */
 
 /*************************** 头文件包含 ****************************/
+#include <arch-bitops.h>
+#include <atomic.h>
+#include <backtrace.h>
 #include <barrier.h>
 #include <errno.h>
 #include <ipi.h>
+#include <mmu.h>
+#include <spinlock.h>
 #include <system/bitops.h>
 #include <system/types.h>
+#include <tlb.h>
 #include <ttos.h>
 #include <ttosBase.h>
 #include <ttos_pic.h>
 
+#define KLOG_TAG "ipi"
+#include <klog.h>
+
 /*************************** 宏定义 ****************************/
 
+/**
+ * @brief 范围击落的页数上限，超过则退化为用户空间全量刷新
+ */
+#define IPI_TLB_FLUSH_PAGE_MAX 64U
+
+/**
+ * @defgroup IPIBacktraceState 跨核backtrace快照缓冲状态
+ * @{
+ */
+#define IPI_BT_IDLE 0    /**< @brief 空闲，可被发起核认领 */
+#define IPI_BT_PENDING 1 /**< @brief 已认领，等待目标核采集 */
+#define IPI_BT_DONE 2    /**< @brief 目标核采集完成 */
+/** @} */
+
+/**
+ * @brief 发起核等待目标核采集完成的轮询次数上限
+ *
+ * @details 目标核关中断卡死时放弃等待并跳过，发起核不被拖死
+ */
+#define IPI_BT_SPIN_MAX 10000000U
+
+/**
+ * @brief 跨CPU调用请求队列索引掩码
+ */
+#define IPI_CALL_QUEUE_MASK (IPI_CALL_QUEUE_DEPTH - 1U)
+
+/**
+ * @defgroup IPIIocsrRegs 本核IPI消息寄存器（IOCSR地址）
+ * @{
+ */
+#define IOCSR_IPI_STATUS 0x1000U /**< @brief 挂起消息位图（只读） */
+#define IOCSR_IPI_CLEAR 0x100CU  /**< @brief 消息清除（写1清对应位） */
+/** @} */
+
 /*************************** 类型定义 ****************************/
 
+/**
+ * @brief TLB击落IPI载荷
+ */
+struct tlb_flush_payload
+{
+    unsigned long asid;  /**< @brief 地址空间标识 */
+    unsigned long vaddr; /**< @brief 起始虚拟地址 */
+    unsigned long size;  /**< @brief 范围长度（字节） */
+};
+
+/**
+ * @brief per-CPU backtrace快照缓冲
+ *
+ * @details 缓存行对齐避免伪共享；state由发起核CAS认领、
+ *          目标核置完成、发起核收集后复位，单缓冲无锁流转
+ */
+struct ipi_bt_snapshot
+{
+    volatile int state;                 /**< @brief 缓冲状态（IPI_BT_*） */
+    unsigned int depth;                 /**< @brief 实际捕获层数 */
+    uintptr_t pc[IPI_BACKTRACE_DEPTH];  /**< @brief 各层调用点地址 */
+} __attribute__((aligned(64)));
+
+/**
+ * @brief 跨CPU调用请求
+ */
+struct ipi_call_entry
+{
+    smp_call_fn func;           /**< @brief 要执行的函数 */
+    void *arg;                  /**< @brief 函数参数 */
+    volatile int *done;         /**< @brief 完成计数指针（fire-and-forget为NULL） */
+};
+
+/**
+ * @brief 每对CPU（来源→目标）的SPSC请求队列
+ *
+ * @details 生产者唯一（来源核，入队期间关中断），消费者唯一
+ *          （目标核中断），读写指针无需加锁；缓存行对齐避免伪共享
+ */
+struct ipi_call_queue
+{
+    struct ipi_call_entry buf[IPI_CALL_QUEUE_DEPTH]; /**< @brief 请求数组 */
+    volatile unsigned int head;                      /**< @brief 写指针（来源核） */
+    volatile unsigned int tail;                      /**< @brief 读指针（目标核） */
+} __attribute__((aligned(64)));
+
 /*************************** 外部声明 ****************************/
 extern int32_t loongson2k_pic_ipi_ack(struct ttos_pic *pic, uint32_t *src_cpu, uint32_t *irq);
 
 /*************************** 前向声明 ****************************/
 
 /*************************** 模块变量 ****************************/
+static DEFINE_SPINLOCK(tlb_flush_lock);          /* 序列化发送核，载荷全局唯一 */
+static struct tlb_flush_payload tlb_flush_req;   /* 当前在途的击落请求 */
+static volatile int tlb_flush_ack;               /* 已完成无效化的接收核计数 */
+
+/* per-CPU backtrace快照缓冲，目标核只写本核槽位 */
+static struct ipi_bt_snapshot s_bt_snap[CONFIG_MAX_CPUS];
+
+/* 跨CPU调用请求队列：[目标核][来源核]，每对SPSC */
+static struct ipi_call_queue s_call_queue[CONFIG_MAX_CPUS][CONFIG_MAX_CPUS];
+
+/**
+ * @brief per-CPU未决reschedule IPI标志
+ *
+ * @details 缓存行对齐避免伪共享；发送核CAS置位去重，
+ *          目标核处理前清位
+ */
+struct ipi_sched_pending
+{
+    volatile int pending; /**< @brief 是否已有未决reschedule IPI */
+} __attribute__((aligned(64)));
+
+/* per-CPU未决reschedule IPI标志：合并同一tick内的重复请求 */
+static struct ipi_sched_pending s_sched_pending[CONFIG_MAX_CPUS];
 
 /*************************** 全局变量 ****************************/
 
@@ -92,9 +204,19 @@ static s32 ipi_send(cpu_set_t *cpus, u32 ipi, bool selfexcluded)
     {
         if (CPU_ISSET(cpu, &target_cpus))
         {
-            if ((GENERAL_IPI_SCHED == ipi) && (FALSE == ttosIsNeedRescheduleWithCpuId(cpu)))
+            if (GENERAL_IPI_SCHED == ipi)
             {
-                continue;
+                if (FALSE == ttosIsNeedRescheduleWithCpuId(cpu))
+                {
+                    continue;
+                }
+
+                /* 去重：已有未决reschedule IPI则跳过硬件发送，
+                 * 目标核每tick最多被打断一次 */
+                if (atomic32_cas(&s_sched_pending[cpu].pending, 0, 1) != 0)
+                {
+                    continue;
+                }
             }
             /* 发送ipi */
             ttos_pic_ipi_send(GENERAL_IPI_SCHED, cpu, 0);
@@ -136,13 +258,519 @@ s32 ipi_reschedule(cpu_set_t *cpus, bool selfexcluded)
  */
 void ipi_reschedule_handler(u32 irq, void *param)
 {
+    /* 调度前清位：调度期间到达的新请求能再次触发IPI，不丢失 */
+    s_sched_pending[cpuid_get()].pending = 0;
+    smp_wmb();
+
     ttosSchedule();    /* 对当前CPU上任务进行调度 */
 }
 
+/**
+ * @brief 执行一次本核范围无效化
+ *
+ * @details 按(asid, vaddr, size)逐页执行invtlb精确无效化，
+ *          范围过大或为0时退化为用户空间全量刷新
+ *
+ * @param[in] asid  地址空间标识
+ * @param[in] vaddr 起始虚拟地址
+ * @param[in] size  范围长度（字节）
+ *
+ * @return 无
+ */
+static void tlb_flush_range_local(unsigned long asid, unsigned long vaddr, unsigned long size)
+{
+    unsigned long end;
+
+    if ((size == 0) || ((size >> PAGE_SIZE_SHIFT) > IPI_TLB_FLUSH_PAGE_MAX))
+    {
+        local_flush_tlb_user();
+        return;
+    }
+
+    end = vaddr + size;
+    vaddr &= ~PAGE_SIZE_MASK;
+    while (vaddr < end)
+    {
+        invtlb(INVTLB_ADDR_GFALSE_AND_ASID, asid, vaddr);
+        vaddr += PAGE_SIZE;
+    }
+}
+
+/**
+ * @brief 发送精确范围TLB击落IPI并同步等待完成
+ *
+ * @details 填充(asid, vaddr, size)载荷后向目标CPU集合发送
+ *          GENERAL_IPI_TLB_FLUSH，本核直接执行无效化，
+ *          自旋等待所有接收核应答后返回
+ *
+ * @param[in] cpus  目的CPU集合。为0时，表示系统中已经使能的CPU
+ * @param[in] asid  地址空间标识（硬件ASID）
+ * @param[in] vaddr 起始虚拟地址（页对齐）
+ * @param[in] size  范围长度（字节）。为0时退化为用户空间全量刷新
+ *
+ * @return 成功返回0，失败返回错误码
+ *
+ * @retval 0 成功
+ */
+s32 ipi_tlb_flush_range(cpu_set_t *cpus, unsigned long asid, unsigned long vaddr, unsigned long size)
+{
+    cpu_set_t target_cpus;
+    int target_count;
+    int self = cpuid_get();
+
+    CPU_ZERO(&target_cpus);
+
+    /* 获取目的cpu集合 */
+    if ((cpus == NULL) || (CPU_COUNT(cpus) == 0))
+    {
+#if CONFIG_SMP == 1
+        CPU_OR(&target_cpus, &target_cpus, TTOS_CPUSET_ENABLED());
+#else
+        CPU_ZERO(&target_cpus);
+        CPU_SET(0, &target_cpus);
+#endif
+    }
+    else
+    {
+        CPU_OR(&target_cpus, &target_cpus, cpus);
+    }
+
+    /* 本核直接执行，不向自己发IPI */
+    if (CPU_ISSET(self, &target_cpus))
+    {
+        tlb_flush_range_local(asid, vaddr, size);
+        CPU_CLR(self, &target_cpus);
+    }
+
+    target_count = CPU_COUNT(&target_cpus);
+    if (target_count == 0)
+    {
+        return (0);
+    }
+
+    /* 只串行化发送核而不关本核中断：等锁或等应答期间仍可
+     * 响应其它核的击落IPI，避免互相等待造成死锁 */
+    spin_lock(&tlb_flush_lock);
+
+    /* 填充载荷后发布，接收核在应答前只读载荷 */
+    tlb_flush_req.asid = asid;
+    tlb_flush_req.vaddr = vaddr;
+    tlb_flush_req.size = size;
+    tlb_flush_ack = 0;
+    smp_wmb();
+
+    for (int cpu = 0; cpu < CONFIG_MAX_CPUS; cpu++)
+    {
+        if (CPU_ISSET(cpu, &target_cpus))
+        {
+            ttos_pic_ipi_send(GENERAL_IPI_TLB_FLUSH, cpu, 0);
+        }
+    }
+
+    /* 同步等待所有接收核完成无效化 */
+    while (tlb_flush_ack < target_count)
+    {
+        smp_rmb();
+    }
+
+    spin_unlock(&tlb_flush_lock);
+
+    return (0);
+}
+
+/**
+ * @brief TLB击落IPI中断处理函数
+ *
+ * @details 按载荷中的地址范围逐页无效化本核TLB并应答发送核
+ *
+ * @param[in] irq 中断号
+ * @param[in] param 私有数据
+ *
+ * @return 无
+ */
+void ipi_tlb_flush_handler(u32 irq, void *param)
+{
+    smp_rmb();
+    tlb_flush_range_local(tlb_flush_req.asid, tlb_flush_req.vaddr, tlb_flush_req.size);
+
+    /* 无效化完成后应答发送核 */
+    atomic32_inc((volatile int *)&tlb_flush_ack);
+}
+
+/**
+ * @brief 发起跨核backtrace快照并收集输出
+ *
+ * @details 排查多核死锁时查看其它核当前卡点，全程不停机：
+ *          1. 发起核以CAS认领目标核的快照缓冲（IDLE→PENDING），
+ *             认领失败说明其它发起核正在收集，直接跳过
+ *          2. 向认领成功的目标核发送GENERAL_IPI_BACKTRACE
+ *          3. 有界轮询等待目标核置DONE，收集后符号化输出并归还缓冲；
+ *             目标核关中断卡死不响应时回收认领并提示，发起核不被拖死
+ *
+ * @param[in] cpus         目的CPU集合。为0时，表示系统中已经使能的CPU
+ * @param[in] selfexcluded 是否排除当前CPU（本核直接回溯，不经IPI）
+ *
+ * @return 成功返回0，无目标CPU返回-EIO
+ *
+ * @retval 0 成功
+ * @retval -EIO 无目标CPU
+ */
+s32 ipi_cpu_backtrace(cpu_set_t *cpus, bool selfexcluded)
+{
+    cpu_set_t target_cpus;
+    cpu_set_t claimed_cpus;
+    int self = cpuid_get();
+
+    CPU_ZERO(&target_cpus);
+    CPU_ZERO(&claimed_cpus);
+
+    /* 获取目的cpu集合 */
+    if ((cpus == NULL) || (CPU_COUNT(cpus) == 0))
+    {
+#if CONFIG_SMP == 1
+        CPU_OR(&target_cpus, &target_cpus, TTOS_CPUSET_ENABLED());
+#else
+        CPU_ZERO(&target_cpus);
+        CPU_SET(0, &target_cpus);
+#endif
+    }
+    else
+    {
+        CPU_OR(&target_cpus, &target_cpus, cpus);
+    }
+
+    /* 本核直接回溯，不向自己发IPI */
+    if (CPU_ISSET(self, &target_cpus))
+    {
+        if (FALSE == selfexcluded)
+        {
+            backtrace("ipi_cpu_backtrace");
+        }
+        CPU_CLR(self, &target_cpus);
+    }
+
+    if (CPU_COUNT(&target_cpus) == 0)
+    {
+        return (-EIO);
+    }
+
+    /* 先认领再发送：认领失败的核由并发的发起核负责收集 */
+    for (int cpu = 0; cpu < CONFIG_MAX_CPUS; cpu++)
+    {
+        if (CPU_ISSET(cpu, &target_cpus))
+        {
+            if (atomic32_cas(&s_bt_snap[cpu].state, IPI_BT_IDLE, IPI_BT_PENDING) != 0)
+            {
+                continue;
+            }
+            CPU_SET(cpu, &claimed_cpus);
+            ttos_pic_ipi_send(GENERAL_IPI_BACKTRACE, cpu, 0);
+        }
+    }
+
+    /* 有界轮询收集各核快照 */
+    for (int cpu = 0; cpu < CONFIG_MAX_CPUS; cpu++)
+    {
+        struct ipi_bt_snapshot *snap = &s_bt_snap[cpu];
+        u32 spin;
+
+        if (!CPU_ISSET(cpu, &claimed_cpus))
+        {
+            continue;
+        }
+
+        for (spin = 0U; (spin < IPI_BT_SPIN_MAX) && (snap->state != IPI_BT_DONE); spin++)
+        {
+            smp_rmb();
+        }
+
+        if (snap->state == IPI_BT_DONE)
+        {
+            smp_rmb();
+            backtrace_snapshot_print((unsigned int)cpu, snap->pc, snap->depth);
+            snap->state = IPI_BT_IDLE;
+        }
+        else
+        {
+            /* 回收认领：CAS失败说明目标核恰好完成，正常收集 */
+            if (atomic32_cas(&snap->state, IPI_BT_PENDING, IPI_BT_IDLE) != 0)
+            {
+                smp_rmb();
+                backtrace_snapshot_print((unsigned int)cpu, snap->pc, snap->depth);
+                snap->state = IPI_BT_IDLE;
+            }
+            else
+            {
+                KLOG_EMERG("cpu%d: no backtrace response", cpu);
+            }
+        }
+    }
+
+    return (0);
+}
+
+/**
+ * @brief 跨核backtrace快照IPI中断处理函数
+ *
+ * @details 在目标核中断上下文把当前调用栈捕获到本核快照缓冲，
+ *          先发布快照内容再置完成标志；只写本核槽位，无锁
+ *
+ * @param[in] irq 中断号
+ * @param[in] param 私有数据
+ *
+ * @return 无
+ */
+void ipi_backtrace_handler(u32 irq, void *param)
+{
+    struct ipi_bt_snapshot *snap = &s_bt_snap[cpuid_get()];
+
+    if (snap->state != IPI_BT_PENDING)
+    {
+        return;
+    }
+
+    snap->depth = backtrace_capture(snap->pc, IPI_BACKTRACE_DEPTH);
+
+    /* 先发布快照内容，再对发起核置完成 */
+    smp_wmb();
+    snap->state = IPI_BT_DONE;
+}
+
+/**
+ * @brief 向指定CPU的请求队列入队一个调用请求
+ *
+ * @details 入队期间关本核中断，保证(目标核, 本核)队列的生产者唯一；
+ *          先填充请求内容再推进写指针对目标核可见
+ *
+ * @param[in] cpu  目标CPU编号
+ * @param[in] func 要执行的函数
+ * @param[in] arg  函数参数
+ * @param[in] done 完成计数指针（fire-and-forget为NULL）
+ *
+ * @return 成功返回0，队列满返回-EAGAIN
+ */
+static s32 ipi_call_enqueue(int cpu, smp_call_fn func, void *arg, volatile int *done)
+{
+    struct ipi_call_queue *queue;
+    struct ipi_call_entry *entry;
+    unsigned long flags;
+    unsigned int head;
+
+    raw_local_irq_save(flags);
+
+    queue = &s_call_queue[cpu][cpuid_get()];
+    head = queue->head;
+
+    if (((head + 1U) & IPI_CALL_QUEUE_MASK) == (queue->tail & IPI_CALL_QUEUE_MASK))
+    {
+        raw_local_irq_restore(flags);
+
+        return (-EAGAIN);
+    }
+
+    entry = &queue->buf[head & IPI_CALL_QUEUE_MASK];
+    entry->func = func;
+    entry->arg = arg;
+    entry->done = done;
+
+    /* 先发布请求内容，再推进写指针对消费核可见 */
+    smp_wmb();
+    queue->head = head + 1U;
+
+    raw_local_irq_restore(flags);
+
+    return (0);
+}
+
+/**
+ * @brief 在指定CPU上执行函数
+ *
+ * @details 入队请求并发送GENERAL_IPI_CALL；目标为本核时直接
+ *          关中断执行，与中断上下文语义一致
+ *
+ * @param[in] cpu  目标CPU编号
+ * @param[in] func 要执行的函数（在目标核中断上下文运行）
+ * @param[in] arg  传给func的参数
+ * @param[in] wait 是否同步等待执行完成
+ *
+ * @return 成功返回0，参数无效返回-EINVAL，队列满返回-EAGAIN
+ *
+ * @retval 0 成功
+ * @retval -EINVAL 参数无效
+ * @retval -EAGAIN 目标队列满
+ */
+s32 smp_call_function_single(int cpu, smp_call_fn func, void *arg, bool wait)
+{
+    volatile int done = 0;
+    unsigned long flags;
+    s32 ret;
+
+    if ((func == NULL) || (cpu < 0) || (cpu >= CONFIG_MAX_CPUS))
+    {
+        return (-EINVAL);
+    }
+
+    /* 本核直接执行，不经IPI */
+    if (cpu == cpuid_get())
+    {
+        raw_local_irq_save(flags);
+        func(arg);
+        raw_local_irq_restore(flags);
+
+        return (0);
+    }
+
+    ret = ipi_call_enqueue(cpu, func, arg, (TRUE == wait) ? &done : NULL);
+    if (ret != 0)
+    {
+        return ret;
+    }
+
+    ttos_pic_ipi_send(GENERAL_IPI_CALL, cpu, 0);
+
+    if (TRUE == wait)
+    {
+        /* 开中断等待：期间可响应对端的调用请求，互相同步调用不死锁 */
+        while (done == 0)
+        {
+            smp_rmb();
+        }
+    }
+
+    return (0);
+}
+
+/**
+ * @brief 在CPU集合上执行函数
+ *
+ * @details 向集合内每个核入队请求并发送GENERAL_IPI_CALL，
+ *          本核在集合内时直接执行；wait为真时等待所有目标核完成
+ *
+ * @param[in] cpus 目的CPU集合。为0时，表示系统中已经使能的CPU
+ * @param[in] func 要执行的函数（在目标核中断上下文运行）
+ * @param[in] arg  传给func的参数
+ * @param[in] wait 是否同步等待所有目标核执行完成
+ *
+ * @return 成功返回0，参数无效返回-EINVAL，任一目标队列满返回-EAGAIN
+ *
+ * @retval 0 成功
+ * @retval -EINVAL 参数无效
+ * @retval -EAGAIN 部分目标队列满（已入队的仍会执行）
+ */
+s32 smp_call_function_mask(cpu_set_t *cpus, smp_call_fn func, void *arg, bool wait)
+{
+    cpu_set_t target_cpus;
+    volatile int done = 0;
+    unsigned long flags;
+    int sent = 0;
+    int self = cpuid_get();
+    s32 ret = 0;
+
+    if (func == NULL)
+    {
+        return (-EINVAL);
+    }
+
+    CPU_ZERO(&target_cpus);
+
+    /* 获取目的cpu集合 */
+    if ((cpus == NULL) || (CPU_COUNT(cpus) == 0))
+    {
+#if CONFIG_SMP == 1
+        CPU_OR(&target_cpus, &target_cpus, TTOS_CPUSET_ENABLED());
+#else
+        CPU_ZERO(&target_cpus);
+        CPU_SET(0, &target_cpus);
+#endif
+    }
+    else
+    {
+        CPU_OR(&target_cpus, &target_cpus, cpus);
+    }
+
+    /* 本核直接执行，不向自己发IPI */
+    if (CPU_ISSET(self, &target_cpus))
+    {
+        raw_local_irq_save(flags);
+        func(arg);
+        raw_local_irq_restore(flags);
+        CPU_CLR(self, &target_cpus);
+    }
+
+    for (int cpu = 0; cpu < CONFIG_MAX_CPUS; cpu++)
+    {
+        if (CPU_ISSET(cpu, &target_cpus))
+        {
+            if (ipi_call_enqueue(cpu, func, arg, (TRUE == wait) ? &done : NULL) != 0)
+            {
+                ret = (-EAGAIN);
+                continue;
+            }
+            ttos_pic_ipi_send(GENERAL_IPI_CALL, cpu, 0);
+            sent++;
+        }
+    }
+
+    if (TRUE == wait)
+    {
+        /* 开中断等待所有已入队的目标核完成 */
+        while (done < sent)
+        {
+            smp_rmb();
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * @brief 跨CPU函数调用IPI中断处理函数
+ *
+ * @details 逐个排空本核的所有来源队列：先拷出请求并推进读指针
+ *          释放槽位，再执行函数，最后对同步请求应答完成计数
+ *
+ * @param[in] irq 中断号
+ * @param[in] param 私有数据
+ *
+ * @return 无
+ */
+void ipi_call_handler(u32 irq, void *param)
+{
+    int self = cpuid_get();
+
+    for (int src = 0; src < CONFIG_MAX_CPUS; src++)
+    {
+        struct ipi_call_queue *queue = &s_call_queue[self][src];
+
+        while (queue->tail != queue->head)
+        {
+            struct ipi_call_entry entry;
+
+            /* 先读指针后读内容，与生产侧的发布顺序配对 */
+            smp_rmb();
+            entry = queue->buf[queue->tail & IPI_CALL_QUEUE_MASK];
+            queue->tail++;
+
+            entry.func(entry.arg);
+
+            /* 同步请求：执行完成后应答发起核 */
+            if (entry.done != NULL)
+            {
+                atomic32_inc(entry.done);
+            }
+        }
+    }
+}
+
 /**
  * @brief LoongArch IPI中断处理函数
  *
- * @details 处理LoongArch核间中断
+ * @details 批量收割本核挂起的全部IPI消息：一次读取IOCSR状态
+ *          位图并整体写1清除，随后按位分发到各消息处理函数，
+ *          N条并发消息只付一次异常进出与一对状态寄存器访问
+ *          的代价；先清后派发，处理期间新到的消息重新拉线，
+ *          不丢失。各处理函数内部的per发送核请求队列（跨CPU
+ *          调用）在一次派发内整体搬空
  *
  * @param[in] irq 中断号
  * @param[in] arg 参数
@@ -153,7 +781,25 @@ void loongson_ipi_interrupt(uint32_t irq, void *arg)
 {
     struct ttos_pic *pic_node;
     uint32_t from_cpu;
+    u32 pending;
+
+    /* 一次取走全部挂起位并整体清除，消息位号与IPI中断号线性对应 */
+    pending = iocsr_read32(IOCSR_IPI_STATUS);
+    if (pending != 0U)
+    {
+        iocsr_write32(pending, IOCSR_IPI_CLEAR);
+        smp_mb();
+
+        while (pending != 0U)
+        {
+            u32 bit = arch_ctz32(pending);
+
+            pending &= pending - 1U;
+            ttos_pic_irq_handle(CPU_IPI0 + bit);
+        }
+    }
 
+    /* 兜底：驱动侧仍在跟踪的残留消息走原确认/应答路径 */
     pic_node = ttos_pic_get_pic(PIC_FLAG_CPU);
     if (pic_node != NULL)
     {
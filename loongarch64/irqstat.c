@@ -0,0 +1,163 @@
+/**
+ * @file    irqstat.c
+ * @brief   per-CPU异常/中断/系统调用统计实现
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件实现per-CPU中断与异常统计面板
+ *          - 统计数组静态分配，按缓存行对齐，各核只写自己的
+ *            面板，记录路径无锁无原子操作
+ *          - 查询接口只读复制统计槽，供诊断工具按核汇总；
+ *            跨核读取为近似快照，不加同步
+ *          - irqstat_dump按核经klog导出非零槽，用于中断风暴定位
+ *
+ * @note MISRA-C:2012 合规
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#define KLOG_TAG "irqstat"
+
+/*************************** 头文件包含 ****************************/
+#include <cpu.h>
+#include <errno.h>
+#include <irqstat.h>
+#include <klog.h>
+#include <stddef.h>
+
+/*************************** 宏定义 ****************************/
+
+
+/*************************** 数据结构 ****************************/
+
+
+/*************************** 全局变量 ****************************/
+/* per-CPU统计面板（缓存行对齐，热路径各核只写本核项） */
+struct irqstat_cpu g_irqstat[CONFIG_MAX_CPUS];
+
+/*************************** 内部函数声明 ****************************/
+static void irqstat_entry_dump(const char *kind, u32 idx, const struct irqstat_entry *entry);
+
+/*************************** 函数实现 ****************************/
+
+/**
+ * @brief 只读查询指定核的中断统计
+ *
+ * @param cpu 目标CPU编号
+ * @param irq 中断号
+ * @param out 统计输出
+ *
+ * @return 成功返回0，参数无效返回-EINVAL
+ */
+s32 irqstat_irq_get(u32 cpu, u32 irq, struct irqstat_entry *out)
+{
+    if ((cpu >= CONFIG_MAX_CPUS) || (irq >= IRQSTAT_IRQ_SLOTS) || (out == NULL))
+    {
+        return -EINVAL;
+    }
+
+    *out = g_irqstat[cpu].irq[irq];
+
+    return 0;
+}
+
+/**
+ * @brief 只读查询指定核的异常统计
+ *
+ * @param cpu   目标CPU编号
+ * @param ecode 异常码
+ * @param out   统计输出
+ *
+ * @return 成功返回0，参数无效返回-EINVAL
+ */
+s32 irqstat_exc_get(u32 cpu, u32 ecode, struct irqstat_entry *out)
+{
+    if ((cpu >= CONFIG_MAX_CPUS) || (ecode >= IRQSTAT_EXC_SLOTS) || (out == NULL))
+    {
+        return -EINVAL;
+    }
+
+    *out = g_irqstat[cpu].exc[ecode];
+
+    return 0;
+}
+
+/**
+ * @brief 只读查询指定核的系统调用统计
+ *
+ * @param cpu 目标CPU编号
+ * @param out 统计输出
+ *
+ * @return 成功返回0，参数无效返回-EINVAL
+ */
+s32 irqstat_syscall_get(u32 cpu, struct irqstat_entry *out)
+{
+    if ((cpu >= CONFIG_MAX_CPUS) || (out == NULL))
+    {
+        return -EINVAL;
+    }
+
+    *out = g_irqstat[cpu].syscall;
+
+    return 0;
+}
+
+/**
+ * @brief 导出单个非零统计槽
+ *
+ * @param kind  槽类型名（exc/irq/syscall）
+ * @param idx   槽编号
+ * @param entry 统计槽
+ */
+static void irqstat_entry_dump(const char *kind, u32 idx, const struct irqstat_entry *entry)
+{
+    u64 avg = entry->cycles / entry->count;
+
+    KLOG_I("  %s[%u]: count=%llu avg=%llu max=%llu (cycles)",
+           kind, idx, (unsigned long long)entry->count,
+           (unsigned long long)avg, (unsigned long long)entry->max_cycles);
+}
+
+/**
+ * @brief 按核经klog汇总导出非零统计槽
+ *
+ * @details 遍历指定核的异常/中断/系统调用槽，只输出count非零项，
+ *          每项给出次数、平均与最大单次耗时
+ *
+ * @param cpu 目标CPU编号
+ */
+void irqstat_dump(u32 cpu)
+{
+    const struct irqstat_cpu *stat = NULL;
+    u32 i;
+
+    if (cpu >= CONFIG_MAX_CPUS)
+    {
+        return;
+    }
+
+    stat = &g_irqstat[cpu];
+    KLOG_I("cpu%u:", cpu);
+
+    for (i = 0U; i < IRQSTAT_EXC_SLOTS; i++)
+    {
+        if (stat->exc[i].count != 0U)
+        {
+            irqstat_entry_dump("exc", i, &stat->exc[i]);
+        }
+    }
+
+    for (i = 0U; i < IRQSTAT_IRQ_SLOTS; i++)
+    {
+        if (stat->irq[i].count != 0U)
+        {
+            irqstat_entry_dump("irq", i, &stat->irq[i]);
+        }
+    }
+
+    if (stat->syscall.count != 0U)
+    {
+        irqstat_entry_dump("syscall", 0U, &stat->syscall);
+    }
+}
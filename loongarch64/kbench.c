@@ -0,0 +1,401 @@
+/**
+ * @file    kbench.c
+ * @brief   内核延迟基准套件实现
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件实现内建延迟基准套件
+ *          - 上下文切换往返：setjmp式调用save后立即restore，
+ *            restore跳回save调用点返回1，一次往返一个样本
+ *          - 中断分发延迟：do_irq入口与首次handler分发两处打点，
+ *            从真实中断被动采集，武装窗口外开销为单次分支
+ *          - null syscall往返：向空闲调用号临时安装空处理函数并
+ *            注册为快速调用，循环执行syscall指令测完整陷入/返回
+ *          - 样本统计用迭代插入排序取min/p50/p99/max，另输出
+ *            按2的幂分桶的对数直方图，经klog导出
+ *
+ * @note MISRA-C:2012 合规
+ * @note 仅用于性能回归测量，不参与任何运行时功能
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#define KLOG_TAG "kbench"
+
+/*************************** 头文件包含 ****************************/
+#include <arch-bitops.h>
+#include <atomic.h>
+#include <barrier.h>
+#include <context.h>
+#include <cpu.h>
+#include <errno.h>
+#include <kbench.h>
+#include <klog.h>
+#include <stddef.h>
+#include <syscall-fast.h>
+#include <syscalls.h>
+#include <ttos_time.h>
+
+/*************************** 宏定义 ****************************/
+/* 上下文切换与syscall基准样本数 */
+#define KBENCH_SAMPLES 1024U
+
+/* 中断分发基准样本数 */
+#define KBENCH_IRQ_SAMPLES 256U
+
+/* 对数直方图桶数（桶i覆盖[2^i, 2^(i+1))周期） */
+#define KBENCH_HIST_BUCKETS 16U
+
+/* 中断样本采集超时（秒） */
+#define KBENCH_IRQ_TIMEOUT_S 5U
+
+/*************************** 外部声明 ****************************/
+extern s32 tbspSaveTaskContext(T_TBSP_TaskContext *ctx);
+extern s32 tbspRestoreTaskContext(T_TBSP_TaskContext *ctx);
+extern s32 tbspSaveTaskContextFast(T_TBSP_TaskContext *ctx);
+extern s32 tbspRestoreTaskContextFast(T_TBSP_TaskContext *ctx);
+extern syscall_func syscall_table[CONFIG_SYSCALL_NUM];
+
+/*************************** 模块变量 ****************************/
+/* 样本缓冲（上下文切换与syscall基准复用，单组串行执行） */
+static u32 s_samples[KBENCH_SAMPLES];
+
+/* 上下文切换基准用上下文（关中断窗口内使用） */
+static T_TBSP_TaskContext s_bench_ctx;
+
+/* 中断分发基准武装标志：中断路径的首个判断 */
+static volatile int s_irq_armed;
+
+/* 中断分发样本写索引（多核中断并发写，原子推进） */
+static volatile int s_irq_count;
+
+/* 中断分发样本缓冲 */
+static u32 s_irq_samples[KBENCH_IRQ_SAMPLES];
+
+/*************************** 内部函数声明 ****************************/
+static void kbench_sort(u32 *arr, u32 count);
+static void kbench_report(const char *name, u32 *samples, u32 count);
+static void kbench_ctxsw(const char *name, int fast);
+static s32 kbench_irq(void);
+static s32 kbench_syscall(s32 num);
+static long kbench_syscall_noop(long arg0, long arg1, long arg2, long arg3, long arg4, long arg5);
+
+/*************************** 函数实现 ****************************/
+
+/**
+ * @brief 样本升序排序
+ *
+ * @details 迭代插入排序；样本数不超过1024且仅在基准路径执行，
+ *          无需更复杂算法
+ */
+static void kbench_sort(u32 *arr, u32 count)
+{
+    u32 i;
+    u32 j;
+    u32 key;
+
+    for (i = 1U; i < count; i++)
+    {
+        key = arr[i];
+        j = i;
+        while ((j > 0U) && (arr[j - 1U] > key))
+        {
+            arr[j] = arr[j - 1U];
+            j--;
+        }
+        arr[j] = key;
+    }
+}
+
+/**
+ * @brief 输出一组样本的统计与直方图
+ *
+ * @details 排序后取min/p50/p99/max，再按2的幂分桶输出对数直方图；
+ *          全部经klog导出，单位为rdtime.d周期
+ *
+ * @param name    基准名称
+ * @param samples 样本数组（就地排序）
+ * @param count   样本数（大于0）
+ */
+static void kbench_report(const char *name, u32 *samples, u32 count)
+{
+    u32 hist[KBENCH_HIST_BUCKETS] = {0U};
+    u32 bucket;
+    u32 i;
+
+    kbench_sort(samples, count);
+
+    KLOG_I("%s: n=%u min=%u p50=%u p99=%u max=%u (cycles)",
+           name, count, samples[0], samples[count / 2U],
+           samples[(count * 99U) / 100U], samples[count - 1U]);
+
+    for (i = 0U; i < count; i++)
+    {
+        if (samples[i] == 0U)
+        {
+            bucket = 0U;
+        }
+        else
+        {
+            bucket = 31U - arch_clz32(samples[i]);
+        }
+        if (bucket >= KBENCH_HIST_BUCKETS)
+        {
+            bucket = KBENCH_HIST_BUCKETS - 1U;
+        }
+        hist[bucket]++;
+    }
+
+    for (i = 0U; i < KBENCH_HIST_BUCKETS; i++)
+    {
+        if (hist[i] != 0U)
+        {
+            KLOG_I("%s: hist[2^%u,2^%u) = %u", name, i, i + 1U, hist[i]);
+        }
+    }
+}
+
+/**
+ * @brief 上下文切换往返基准
+ *
+ * @details save返回0后立即restore，restore跳回save调用点返回1，
+ *          一次完整保存+恢复往返计一个样本；全程关中断，
+ *          防止抢占破坏基准上下文
+ *
+ * @param name 基准名称
+ * @param fast 非0测快速路径，0测全量路径
+ */
+static void kbench_ctxsw(const char *name, int fast)
+{
+    long flags;
+    u64 t0;
+    u32 i;
+
+    raw_local_irq_save(flags);
+
+    /* 快速路径不保存地址空间与EUEN，恢复侧会写这些字段，预填现值 */
+    s_bench_ctx.pgdl = csr_read64(LOONGARCH_CSR_PGDL);
+    s_bench_ctx.asid = csr_read64(LOONGARCH_CSR_ASID);
+    s_bench_ctx.csr_euen = csr_read64(LOONGARCH_CSR_EUEN);
+
+    for (i = 0U; i < KBENCH_SAMPLES; i++)
+    {
+        t0 = drdtime();
+        if (fast != 0)
+        {
+            if (tbspSaveTaskContextFast(&s_bench_ctx) == 0)
+            {
+                (void)tbspRestoreTaskContextFast(&s_bench_ctx);
+            }
+        }
+        else
+        {
+            if (tbspSaveTaskContext(&s_bench_ctx) == 0)
+            {
+                (void)tbspRestoreTaskContext(&s_bench_ctx);
+            }
+        }
+        s_samples[i] = (u32)(drdtime() - t0);
+    }
+
+    raw_local_irq_restore(flags);
+
+    kbench_report(name, s_samples, KBENCH_SAMPLES);
+}
+
+/**
+ * @brief 中断分发基准：do_irq入口打点
+ *
+ * @details 由do_irq在函数入口调用
+ *
+ * @return 基准武装时返回入口时间戳，否则返回0
+ *
+ * @note 性能关键路径：未武装时单次分支返回
+ */
+u64 kbench_irq_entry(void)
+{
+    if (s_irq_armed == 0)
+    {
+        return 0U;
+    }
+
+    return drdtime();
+}
+
+/**
+ * @brief 中断分发基准：handler分发打点
+ *
+ * @details 记录do_irq入口到首次handler分发的周期差；
+ *          样本索引原子推进，多核中断并发安全；缓冲满自动解除武装
+ *
+ * @param entry_tsc kbench_irq_entry返回的入口时间戳（0表示跳过）
+ */
+void kbench_irq_dispatch(u64 entry_tsc)
+{
+    int idx;
+
+    if ((entry_tsc == 0U) || (s_irq_armed == 0))
+    {
+        return;
+    }
+
+    idx = atomic32_add(&s_irq_count, 1);
+    if (idx >= (int)KBENCH_IRQ_SAMPLES)
+    {
+        s_irq_armed = 0;
+
+        return;
+    }
+
+    s_irq_samples[idx] = (u32)(drdtime() - entry_tsc);
+}
+
+/**
+ * @brief 中断分发延迟基准
+ *
+ * @details 武装采集窗口后idle等待，从真实中断（定时器、IPI等）
+ *          被动采集do_irq入口到首次分发的延迟；采满或超时解除武装
+ *
+ * @return 成功返回0，窗口内无中断样本返回-EAGAIN
+ */
+static s32 kbench_irq(void)
+{
+    u64 deadline;
+    u32 count;
+
+    deadline = drdtime() + (ttos_time_freq_get() * (u64)KBENCH_IRQ_TIMEOUT_S);
+
+    s_irq_count = 0;
+    smp_wmb();
+    s_irq_armed = 1;
+
+    while ((s_irq_count < (int)KBENCH_IRQ_SAMPLES) && (drdtime() < deadline))
+    {
+        __asm__ volatile("idle 0");
+    }
+
+    s_irq_armed = 0;
+    smp_mb();
+
+    count = (u32)s_irq_count;
+    if (count > KBENCH_IRQ_SAMPLES)
+    {
+        count = KBENCH_IRQ_SAMPLES;
+    }
+
+    if (count == 0U)
+    {
+        KLOG_I("irq-dispatch: no samples in window");
+
+        return -EAGAIN;
+    }
+
+    kbench_report("irq-dispatch", s_irq_samples, count);
+
+    return 0;
+}
+
+/**
+ * @brief null syscall空处理函数
+ *
+ * @details 基准期间临时安装到空闲系统调用号
+ */
+static long kbench_syscall_noop(long arg0, long arg1, long arg2, long arg3, long arg4, long arg5)
+{
+    (void)arg0;
+    (void)arg1;
+    (void)arg2;
+    (void)arg3;
+    (void)arg4;
+    (void)arg5;
+
+    return 0;
+}
+
+/**
+ * @brief null syscall往返基准
+ *
+ * @details 向空闲调用号安装空处理函数并注册为快速调用，
+ *          循环执行syscall指令，测量完整陷入→分发→ertn返回
+ *          一次往返的周期；结束后恢复调用号为空
+ *
+ * @param num 空闲系统调用号（对应表项必须为NULL）
+ *
+ * @return 成功返回0，调用号越界返回-EINVAL，表项被占用返回-EBUSY
+ */
+static s32 kbench_syscall(s32 num)
+{
+    u64 t0;
+    u32 i;
+
+    if ((num < 0) || (num >= CONFIG_SYSCALL_NUM))
+    {
+        return -EINVAL;
+    }
+
+    /* 只借用空闲表项，不覆盖真实系统调用 */
+    if (syscall_table[num] != NULL)
+    {
+        return -EBUSY;
+    }
+
+    syscall_table[num] = kbench_syscall_noop;
+    (void)syscall_fast_register((int)num);
+
+    for (i = 0U; i < KBENCH_SAMPLES; i++)
+    {
+        register long num_reg __asm__("$r11") = (long)num;
+
+        t0 = drdtime();
+        __asm__ volatile("syscall 0"
+                         : "+r"(num_reg)
+                         :
+                         : "$r1", "$r4", "$r5", "$r6", "$r7", "$r8", "$r9", "$r10",
+                           "$r12", "$r13", "$r14", "$r15", "$r16", "$r17", "$r18",
+                           "$r19", "$r20", "memory");
+        s_samples[i] = (u32)(drdtime() - t0);
+    }
+
+    (void)syscall_fast_unregister((int)num);
+    syscall_table[num] = NULL;
+
+    kbench_report("null-syscall", s_samples, KBENCH_SAMPLES);
+
+    return 0;
+}
+
+/**
+ * @brief 运行延迟基准套件
+ *
+ * @details 依次执行全量/快速上下文切换、中断分发、null syscall
+ *          基准，结果经klog输出
+ *
+ * @param syscall_num 用于null syscall基准的空闲系统调用号，
+ *                    传负值跳过该项基准
+ *
+ * @return 成功返回0，失败返回负错误码
+ */
+s32 kbench_run(s32 syscall_num)
+{
+    s32 ret = 0;
+
+    KLOG_I("kbench: counter freq %u Hz", (u32)ttos_time_freq_get());
+
+    kbench_ctxsw("ctxsw-full", 0);
+    kbench_ctxsw("ctxsw-fast", 1);
+
+    ret = kbench_irq();
+
+    if (syscall_num >= 0)
+    {
+        s32 sys_ret = kbench_syscall(syscall_num);
+
+        if (sys_ret != 0)
+        {
+            ret = sys_ret;
+        }
+    }
+
+    return ret;
+}
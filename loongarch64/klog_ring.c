@@ -0,0 +1,407 @@
+/**
+ * @file    klog_ring.c
+ * @brief   LoongArch64 per-CPU无锁日志环形缓冲实现
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件实现per-CPU无锁日志环形缓冲
+ *          - 每CPU一个SPSC环：生产者是本CPU（入队期间关中断），
+ *            消费者是唯一的刷出任务，读写指针无需加锁
+ *          - 定长记录：序号、级别、时间戳、格式串指针和原始参数，
+ *            入队只做固定长度拷贝，格式化推迟到刷出时执行
+ *          - 缓冲满时丢弃新记录并计数，刷出时报告丢弃数量
+ *          - panic路径提供同步转储，直接写串口不依赖任务调度
+ *
+ * @note MISRA-C:2012 合规
+ * @note 入队为性能关键路径：无参数检查，调用方保证格式串有效
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+/*************************** 头文件包含 ****************************/
+#include <barrier.h>
+#include <cpu.h>
+#include <int.h>
+#include <klog-ring.h>
+#include <klog.h>
+#include <stddef.h>
+#include <string.h>
+
+/*************************** 宏定义 ****************************/
+/* 每CPU环形缓冲深度（必须是2的幂） */
+#define KLOG_RING_DEPTH     256U
+
+/* 环形索引掩码 */
+#define KLOG_RING_MASK      (KLOG_RING_DEPTH - 1U)
+
+/* 单条记录格式化后的最大长度 */
+#define KLOG_RING_LINE_MAX  192U
+
+/*************************** 数据结构 ****************************/
+/**
+ * @brief 日志记录（定长）
+ *
+ * @details 入队时只填充本结构，不做格式化
+ */
+struct klog_ring_record
+{
+    unsigned int seq;                   /**< @brief 单调序号（每CPU独立） */
+    int level;                          /**< @brief 日志级别 */
+    unsigned long long tsc;             /**< @brief 入队时间戳（rdtime计数） */
+    const char *fmt;                    /**< @brief 格式串指针（延迟格式化） */
+    long args[KLOG_RING_ARG_MAX];       /**< @brief 原始参数 */
+};
+
+/**
+ * @brief per-CPU环形缓冲
+ *
+ * @details head仅由本CPU写，tail仅由刷出任务写，
+ *          缓存行对齐避免相邻CPU的环产生伪共享
+ */
+struct klog_ring
+{
+    struct klog_ring_record buf[KLOG_RING_DEPTH];   /**< @brief 记录数组 */
+    volatile unsigned int head;                     /**< @brief 写指针（生产者） */
+    volatile unsigned int tail;                     /**< @brief 读指针（消费者） */
+    unsigned int seq;                               /**< @brief 下一个序号 */
+    volatile unsigned int dropped;                  /**< @brief 缓冲满丢弃计数 */
+} __attribute__((aligned(64)));
+
+/*************************** 外部声明 ****************************/
+extern void excPrintstr(char *s);
+
+/*************************** 前向声明 ****************************/
+static void klog_ring_format(const struct klog_ring_record *rec, char *out);
+static void klog_ring_drain_cpu(unsigned int cpu);
+
+/*************************** 模块变量 ****************************/
+/* per-CPU日志环（消费端唯一为刷出任务或panic路径） */
+static struct klog_ring s_klog_ring[CONFIG_MAX_CPUS];
+
+/*************************** 函数实现 ****************************/
+
+/**
+ * @brief 无符号整数转十进制字符串
+ *
+ * @param value 数值
+ * @param out 输出缓冲
+ *
+ * @return 写入的字符数
+ */
+static unsigned int klog_ring_utoa(unsigned long value, char *out)
+{
+    char tmp[24];
+    unsigned int i = 0U;
+    unsigned int n = 0U;
+
+    do
+    {
+        tmp[i] = (char)('0' + (char)(value % 10U));
+        value = value / 10U;
+        i++;
+    } while (value > 0U);
+
+    while (i > 0U)
+    {
+        i--;
+        out[n] = tmp[i];
+        n++;
+    }
+
+    return n;
+}
+
+/**
+ * @brief 无符号整数转十六进制字符串
+ *
+ * @param value 数值
+ * @param out 输出缓冲
+ *
+ * @return 写入的字符数
+ */
+static unsigned int klog_ring_xtoa(unsigned long value, char *out)
+{
+    static const char digits[] = "0123456789abcdef";
+    char tmp[16];
+    unsigned int i = 0U;
+    unsigned int n = 0U;
+
+    do
+    {
+        tmp[i] = digits[value & 0xFU];
+        value = value >> 4U;
+        i++;
+    } while (value > 0U);
+
+    while (i > 0U)
+    {
+        i--;
+        out[n] = tmp[i];
+        n++;
+    }
+
+    return n;
+}
+
+/**
+ * @brief 延迟格式化一条记录
+ *
+ * @details 支持%s、%c、%d、%u、%x、%p和%%，其它转换符按%x处理；
+ *          输出超过KLOG_RING_LINE_MAX时截断
+ *
+ * @param rec 日志记录
+ * @param out 输出缓冲（容量至少KLOG_RING_LINE_MAX字节）
+ */
+static void klog_ring_format(const struct klog_ring_record *rec, char *out)
+{
+    const char *p = rec->fmt;
+    unsigned int pos = 0U;
+    unsigned int argi = 0U;
+
+    while ((*p != '\0') && (pos < (KLOG_RING_LINE_MAX - 24U)))
+    {
+        if (*p != '%')
+        {
+            out[pos] = *p;
+            pos++;
+            p++;
+            continue;
+        }
+
+        p++;
+        if (*p == '\0')
+        {
+            break;
+        }
+
+        if (*p == '%')
+        {
+            out[pos] = '%';
+            pos++;
+            p++;
+            continue;
+        }
+
+        /* 参数耗尽后剩余转换符原样跳过 */
+        if (argi >= KLOG_RING_ARG_MAX)
+        {
+            p++;
+            continue;
+        }
+
+        switch (*p)
+        {
+            case 's':
+            {
+                const char *s = (const char *)rec->args[argi];
+
+                if (s == NULL)
+                {
+                    s = "(null)";
+                }
+                while ((*s != '\0') && (pos < (KLOG_RING_LINE_MAX - 24U)))
+                {
+                    out[pos] = *s;
+                    pos++;
+                    s++;
+                }
+                break;
+            }
+            case 'c':
+                out[pos] = (char)rec->args[argi];
+                pos++;
+                break;
+            case 'd':
+                if (rec->args[argi] < 0)
+                {
+                    out[pos] = '-';
+                    pos++;
+                    pos += klog_ring_utoa((unsigned long)(-rec->args[argi]), &out[pos]);
+                }
+                else
+                {
+                    pos += klog_ring_utoa((unsigned long)rec->args[argi], &out[pos]);
+                }
+                break;
+            case 'u':
+                pos += klog_ring_utoa((unsigned long)rec->args[argi], &out[pos]);
+                break;
+            case 'p':
+                out[pos] = '0';
+                out[pos + 1U] = 'x';
+                pos += 2U;
+                pos += klog_ring_xtoa((unsigned long)rec->args[argi], &out[pos]);
+                break;
+            default:
+                /* 含x在内的其它转换符统一按十六进制输出 */
+                pos += klog_ring_xtoa((unsigned long)rec->args[argi], &out[pos]);
+                break;
+        }
+        argi++;
+        p++;
+    }
+
+    out[pos] = '\0';
+}
+
+/**
+ * @brief 日志记录入队
+ *
+ * @details 性能关键路径：关中断后向本CPU环尾追加一条定长记录，
+ *          缓冲满时丢弃并计数；全程无串口访问，无跨CPU共享写
+ *
+ * @param level 日志级别（klog_level枚举值）
+ * @param fmt 格式串（必须是字符串字面量）
+ * @param arg0 原始参数1
+ * @param arg1 原始参数2
+ * @param arg2 原始参数3
+ * @param arg3 原始参数4
+ *
+ * @return 无
+ */
+void klog_ring_put(int level, const char *fmt, long arg0, long arg1, long arg2, long arg3)
+{
+    struct klog_ring *ring = NULL;
+    struct klog_ring_record *rec = NULL;
+    unsigned long flags = 0UL;
+    unsigned int head = 0U;
+    unsigned int next = 0U;
+
+    raw_local_irq_save(flags);
+
+    ring = &s_klog_ring[cpuid_get()];
+    head = ring->head;
+    next = (head + 1U) & KLOG_RING_MASK;
+
+    if (next == ring->tail)
+    {
+        /* 缓冲满：丢弃新记录，留给刷出任务报告 */
+        ring->dropped++;
+        raw_local_irq_restore(flags);
+        return;
+    }
+
+    rec = &ring->buf[head & KLOG_RING_MASK];
+    rec->seq = ring->seq;
+    rec->level = level;
+    rec->tsc = drdtime();
+    rec->fmt = fmt;
+    rec->args[0] = arg0;
+    rec->args[1] = arg1;
+    rec->args[2] = arg2;
+    rec->args[3] = arg3;
+    ring->seq++;
+
+    /* 先发布记录内容，再推进写指针 */
+    smp_wmb();
+    ring->head = next;
+
+    raw_local_irq_restore(flags);
+}
+
+/**
+ * @brief 刷出单个CPU环中的全部待输出记录
+ *
+ * @details 逐条完成延迟格式化并同步写串口，
+ *          最后报告期间的丢弃数量
+ *
+ * @param cpu CPU编号
+ */
+static void klog_ring_drain_cpu(unsigned int cpu)
+{
+    struct klog_ring *ring = &s_klog_ring[cpu];
+    char line[KLOG_RING_LINE_MAX];
+    char num[24];
+    unsigned int tail = ring->tail;
+    unsigned int dropped = 0U;
+
+    while (tail != ring->head)
+    {
+        /* 先读到写指针，再读记录内容 */
+        smp_rmb();
+        klog_ring_format(&ring->buf[tail & KLOG_RING_MASK], line);
+        excPrintstr(line);
+
+        tail = (tail + 1U) & KLOG_RING_MASK;
+        ring->tail = tail;
+    }
+
+    dropped = ring->dropped;
+    if (dropped != 0U)
+    {
+        ring->dropped = 0U;
+        num[klog_ring_utoa((unsigned long)dropped, num)] = '\0';
+        excPrintstr("[klog] cpu");
+        line[klog_ring_utoa((unsigned long)cpu, line)] = '\0';
+        excPrintstr(line);
+        excPrintstr(" dropped ");
+        excPrintstr(num);
+        excPrintstr(" records\n\r");
+    }
+}
+
+/**
+ * @brief 批量刷出所有CPU的待输出日志
+ *
+ * @details 供低优先级日志任务周期调用，
+ *          依次排空每个CPU的环形缓冲
+ *
+ * @return 无
+ */
+void klog_ring_flush(void)
+{
+    unsigned int cpu;
+
+    for (cpu = 0U; cpu < (unsigned int)CONFIG_MAX_CPUS; cpu++)
+    {
+        klog_ring_drain_cpu(cpu);
+    }
+}
+
+/**
+ * @brief panic时同步转储残留日志
+ *
+ * @details 崩溃路径专用：与klog_ring_flush排空逻辑一致，
+ *          但语义上不依赖日志任务存活，可在关中断上下文调用
+ *
+ * @return 无
+ */
+void klog_ring_panic_dump(void)
+{
+    excPrintstr("[klog] panic dump begin\n\r");
+    klog_ring_flush();
+    excPrintstr("[klog] panic dump end\n\r");
+}
+
+/**
+ * @brief 二进制快照全部CPU的环形缓冲
+ *
+ * @details 把各CPU的环整体（记录数组、读写指针、序号与丢弃
+ *          计数）按原始布局拷贝到目标缓冲，供崩溃快存写入
+ *          保留内存；格式串指针重启后由离线工具结合内核镜像
+ *          解析，此处不做任何格式化
+ *
+ * @param dst 目标缓冲
+ * @param max_bytes 目标缓冲容量（字节）
+ *
+ * @return 实际拷贝的字节数（容量不足时按整环截断）
+ */
+unsigned int klog_ring_snapshot(void *dst, unsigned int max_bytes)
+{
+    unsigned int cpu;
+    unsigned int copied = 0U;
+    char *out = (char *)dst;
+
+    for (cpu = 0U; cpu < (unsigned int)CONFIG_MAX_CPUS; cpu++)
+    {
+        if ((copied + (unsigned int)sizeof(struct klog_ring)) > max_bytes)
+        {
+            break;
+        }
+        memcpy(&out[copied], &s_klog_ring[cpu], sizeof(struct klog_ring));
+        copied += (unsigned int)sizeof(struct klog_ring);
+    }
+
+    return copied;
+}
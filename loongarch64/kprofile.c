@@ -0,0 +1,200 @@
+/**
+ * @file    kprofile.c
+ * @brief   定时器采样剖析器实现
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件实现基于定时器中断的内核采样剖析器
+ *          - 挂接在定时器中断处理路径，按可配置分频采样
+ *          - 每个样本记录被打断的PC（ERA）和调用栈摘要
+ *          - per-CPU SPSC环形缓冲：生产者是本核中断，消费者是
+ *            唯一的导出任务，读写指针无需加锁
+ *          - 缓冲满时丢弃新样本并计数，保证采样路径有界
+ *
+ * @note MISRA-C:2012 合规
+ * @note 采样路径为性能关键路径：未使能时开销为单次分支
+ * @note 调用栈摘要从中断处理帧回溯，在汇编异常入口处截断，
+ *       前几层为中断处理路径自身，导出侧可按需过滤
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+/*************************** 头文件包含 ****************************/
+#include <backtrace.h>
+#include <barrier.h>
+#include <cpu.h>
+#include <errno.h>
+#include <kprofile.h>
+#include <stddef.h>
+
+/*************************** 宏定义 ****************************/
+/* 每CPU样本环深度（必须是2的幂） */
+#define KPROFILE_RING_DEPTH 512U
+
+/* 环形索引掩码 */
+#define KPROFILE_RING_MASK (KPROFILE_RING_DEPTH - 1U)
+
+/*************************** 数据结构 ****************************/
+/**
+ * @brief per-CPU样本环
+ *
+ * @details head仅由本核中断写，tail仅由导出任务写，
+ *          缓存行对齐避免相邻CPU的环产生伪共享
+ */
+struct kprofile_ring
+{
+    struct kprofile_sample buf[KPROFILE_RING_DEPTH]; /**< @brief 样本数组 */
+    volatile unsigned int head;                      /**< @brief 写指针（生产者） */
+    volatile unsigned int tail;                      /**< @brief 读指针（消费者） */
+    unsigned int tick;                               /**< @brief 分频计数（本核私有） */
+    volatile unsigned int dropped;                   /**< @brief 缓冲满丢弃计数 */
+} __attribute__((aligned(64)));
+
+/*************************** 模块变量 ****************************/
+/* 采样使能标志：采样路径的首个判断 */
+static volatile int s_kprofile_enabled;
+
+/* 采样分频：每divisor次定时器中断采一个样本 */
+static volatile unsigned int s_kprofile_divisor = 1U;
+
+/* per-CPU样本环 */
+static struct kprofile_ring s_kprofile_ring[CONFIG_MAX_CPUS];
+
+/*************************** 函数实现 ****************************/
+
+/**
+ * @brief 启动采样剖析
+ *
+ * @details 设置采样分频并使能采样；先发布分频再置使能标志，
+ *          保证各核看到使能时分频已生效
+ *
+ * @param divisor 采样分频（大于等于1）
+ *
+ * @return 成功返回0，分频为0返回-EINVAL
+ */
+int kprofile_start(unsigned int divisor)
+{
+    if (divisor == 0U)
+    {
+        return -EINVAL;
+    }
+
+    s_kprofile_divisor = divisor;
+    smp_wmb();
+    s_kprofile_enabled = 1;
+
+    return 0;
+}
+
+/**
+ * @brief 停止采样剖析
+ *
+ * @details 关闭采样；已入环的样本保留，可继续读出
+ */
+void kprofile_stop(void)
+{
+    s_kprofile_enabled = 0;
+    smp_wmb();
+}
+
+/**
+ * @brief 定时器中断采样入口
+ *
+ * @details 按分频采集样本入本核环：记录采样时刻的异常返回地址
+ *          （即被打断的PC）、时间戳和调用栈摘要；缓冲满时丢弃并
+ *          计数，采样开销有界
+ *
+ * @note 性能关键路径：未使能时单次分支返回，只操作本核数据，无锁
+ */
+void kprofile_timer_sample(void)
+{
+    struct kprofile_ring *ring;
+    struct kprofile_sample *sample;
+    unsigned int head;
+
+    if (s_kprofile_enabled == 0)
+    {
+        return;
+    }
+
+    ring = &s_kprofile_ring[cpuid_get()];
+
+    ring->tick++;
+    if (ring->tick < s_kprofile_divisor)
+    {
+        return;
+    }
+    ring->tick = 0U;
+
+    head = ring->head;
+
+    /* 缓冲满则丢弃新样本，保证中断路径有界 */
+    if (((head + 1U) & KPROFILE_RING_MASK) == (ring->tail & KPROFILE_RING_MASK))
+    {
+        ring->dropped++;
+        return;
+    }
+
+    sample = &ring->buf[head & KPROFILE_RING_MASK];
+    sample->tsc = drdtime();
+    sample->pc = (uintptr_t)csr_read64(LOONGARCH_CSR_ERA);
+    sample->depth = backtrace_capture(sample->stack, KPROFILE_STACK_DEPTH);
+
+    /* 先发布样本内容，再推进写指针对消费者可见 */
+    smp_wmb();
+    ring->head = head + 1U;
+}
+
+/**
+ * @brief 读取指定CPU的样本
+ *
+ * @details 从目标CPU的环形缓冲取出最多max个样本；消费端唯一，
+ *          只推进tail，不与采样核竞争
+ *
+ * @param cpu 目标CPU编号
+ * @param out 输出样本数组
+ * @param max 最多取出的样本数
+ *
+ * @return 实际取出的样本数，参数无效返回-EINVAL
+ */
+int kprofile_read(unsigned int cpu, struct kprofile_sample *out, unsigned int max)
+{
+    struct kprofile_ring *ring;
+    unsigned int count = 0U;
+
+    if ((cpu >= (unsigned int)CONFIG_MAX_CPUS) || (out == NULL))
+    {
+        return -EINVAL;
+    }
+
+    ring = &s_kprofile_ring[cpu];
+
+    while ((count < max) && (ring->tail != ring->head))
+    {
+        /* 先读指针后读内容，与生产侧的发布顺序配对 */
+        smp_rmb();
+        out[count] = ring->buf[ring->tail & KPROFILE_RING_MASK];
+        ring->tail++;
+        count++;
+    }
+
+    return (int)count;
+}
+
+/**
+ * @brief 查询指定CPU因缓冲满丢弃的样本数
+ *
+ * @param cpu 目标CPU编号
+ *
+ * @return 丢弃样本累计数，参数无效返回0
+ */
+unsigned int kprofile_dropped(unsigned int cpu)
+{
+    if (cpu >= (unsigned int)CONFIG_MAX_CPUS)
+    {
+        return 0U;
+    }
+
+    return s_kprofile_ring[cpu].dropped;
+}
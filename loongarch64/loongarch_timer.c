@@ -65,6 +65,9 @@ static ttos_time_ops_t loongarch_timer_ops =
 };
 
 /*************************** 全局变量 ****************************/
+/* walltime折算定点系数：ns = (count * mult) >> shift，启动时预计算 */
+u64 g_ktime_fast_mult;
+u32 g_ktime_fast_shift;
 
 /*************************** 函数实现 ****************************/
 
@@ -149,6 +152,14 @@ void sync_counter(void)
 static void loongarch_timer_freq_init(void)
 {
     cpu_clock_freq = calc_const_freq();
+
+    /* 预计算walltime折算系数：mult = (NSEC_PER_SEC << 32) / freq，
+     * 热路径用128位乘法加移位代替64位除法（3A5000上除法约40周期） */
+    if (cpu_clock_freq != 0U)
+    {
+        g_ktime_fast_shift = 32U;
+        g_ktime_fast_mult = (((u64)NSEC_PER_SEC) << 32U) / cpu_clock_freq;
+    }
 }
 
 /**
@@ -278,22 +289,28 @@ static s32 loongarch_timer_count_set(u64 count)
 /**
  * @brief 获取定时器墙上时间
  *
- * @details 计算并返回当前墙上时间（纳秒）
+ * @details 计算并返回当前墙上时间（纳秒）；使用启动时预计算的
+ *          mult/shift定点系数，热路径无除法
  *
  * @return 返回墙上时间，单位为纳秒
+ *
+ * @note 性能关键路径：128位乘法由mulh.d/mul.d两条指令完成
  */
 static u64 loongarch_timer_walltime_get(void)
 {
     u64 freq, count;
     u64 seconds, nanoseconds, walltime;
 
-    /* 获取频率 */
-    freq = loongarch_timer_freq_get();
-
     /* 获取timer count */
     count = loongarch_timer_count_get();
 
-    /* 计算walltime */
+    if (g_ktime_fast_mult != 0U)
+    {
+        return (u64)(((__uint128_t)count * g_ktime_fast_mult) >> g_ktime_fast_shift);
+    }
+
+    /* 系数未初始化时退回除法路径 */
+    freq = loongarch_timer_freq_get();
     seconds = count / freq;
     nanoseconds = ((count % freq) * NSEC_PER_SEC) / freq;
     walltime = seconds * NSEC_PER_SEC + nanoseconds;
@@ -0,0 +1,343 @@
+/**
+ * @file    membench.c
+ * @brief   内存与缓存操作微基准套件实现
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件实现内存与缓存带宽/延迟基准套件
+ *          - memcpy/memset带宽：工作缓冲对半分为源/目的区，
+ *            按2的幂扫描尺寸，每点多次重复取平均算带宽
+ *          - dcache写回/无效：每次重复前先memset弄脏范围，
+ *            只对维护操作本身计时，尺寸曲线覆盖按行与全量
+ *            路径的切换点
+ *          - 原子操作争用吞吐：经smp_call_function_single把工作
+ *            函数派发到各核，同步放行后并发对同一缓存行执行
+ *            固定次数原子加，核数从1扫到使能核数
+ *          - 结果经klog输出key=value机器可读格式，单位为
+ *            rdtime.d周期与MB/s
+ *
+ * @note MISRA-C:2012 合规
+ * @note 仅用于性能测量与板级验收，不参与任何运行时功能
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#define KLOG_TAG "membench"
+
+/*************************** 头文件包含 ****************************/
+#include <atomic-ext.h>
+#include <atomic.h>
+#include <barrier.h>
+#include <cache-adaptive.h>
+#include <cpu.h>
+#include <errno.h>
+#include <ipi.h>
+#include <klog.h>
+#include <membench.h>
+#include <memfast.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <ttos.h>
+#include <ttos_time.h>
+
+/*************************** 宏定义 ****************************/
+/* 尺寸扫描起点（字节），逐点翻倍直到缓冲上限 */
+#define MEMBENCH_MIN_SIZE 4096U
+
+/* 每个尺寸点的重复次数 */
+#define MEMBENCH_REPS 32U
+
+/* 争用基准每核原子操作次数 */
+#define MEMBENCH_ATOMIC_OPS 4096U
+
+/* 放行标志与完成计数的有界等待上限（防目标核无响应拖死发起核） */
+#define MEMBENCH_SPIN_MAX 10000000U
+
+/*************************** 类型定义 ****************************/
+
+/*************************** 模块变量 ****************************/
+/* 争用基准放行标志：各核自旋等待，发起核置位后统一起跑 */
+static volatile int s_atomic_go;
+
+/* 争用基准完成计数 */
+static volatile int s_atomic_done;
+
+/* 争用目标：独占缓存行，避免与其它变量伪共享 */
+static volatile s64 s_atomic_counter __attribute__((aligned(64)));
+
+/*************************** 内部函数声明 ****************************/
+static u32 membench_bw_mb(u64 bytes, u64 cycles);
+static void membench_copy(void *buf, size_t len);
+static void membench_dcache(void *buf, size_t len);
+static void membench_atomic_worker(void *arg);
+static void membench_atomic(void);
+
+/*************************** 函数实现 ****************************/
+
+/**
+ * @brief 周期数折算为带宽
+ *
+ * @param bytes  搬运总字节数
+ * @param cycles 消耗的rdtime.d周期数
+ *
+ * @return 带宽（MB/s），cycles为0时返回0
+ */
+static u32 membench_bw_mb(u64 bytes, u64 cycles)
+{
+    if (cycles == 0U)
+    {
+        return 0U;
+    }
+
+    return (u32)((bytes * ttos_time_freq_get()) / (cycles * 1000000ULL));
+}
+
+/**
+ * @brief memcpy/memset带宽基准
+ *
+ * @details 缓冲对半分为源/目的区，尺寸按2的幂从MEMBENCH_MIN_SIZE
+ *          扫到半区上限；每点先做一次预热再计时，平均到单次
+ *
+ * @param buf 工作缓冲（缓存行对齐）
+ * @param len 缓冲长度（字节）
+ */
+static void membench_copy(void *buf, size_t len)
+{
+    size_t half = (len / 2U) & ~(size_t)63U;
+    u8 *src = (u8 *)buf;
+    u8 *dst = src + half;
+    size_t size;
+    u64 t0;
+    u64 cycles;
+    u32 i;
+
+    for (size = MEMBENCH_MIN_SIZE; size <= half; size *= 2U)
+    {
+        /* 预热：填充源区并完成首次搬运，排除冷缓存与页表噪声 */
+        (void)arch_memset_fast(src, 0x5A, size);
+        (void)arch_memcpy_fast(dst, src, size);
+
+        t0 = drdtime();
+        for (i = 0U; i < MEMBENCH_REPS; i++)
+        {
+            (void)arch_memcpy_fast(dst, src, size);
+        }
+        cycles = drdtime() - t0;
+
+        KLOG_I("memcpy: size=%u reps=%u avg=%u cycles bw=%u MB/s",
+               (u32)size, MEMBENCH_REPS, (u32)(cycles / MEMBENCH_REPS),
+               membench_bw_mb((u64)size * MEMBENCH_REPS, cycles));
+    }
+
+    for (size = MEMBENCH_MIN_SIZE; size <= len; size *= 2U)
+    {
+        (void)arch_memset_fast(buf, 0xA5, size);
+
+        t0 = drdtime();
+        for (i = 0U; i < MEMBENCH_REPS; i++)
+        {
+            (void)arch_memset_fast(buf, 0xA5, size);
+        }
+        cycles = drdtime() - t0;
+
+        KLOG_I("memset: size=%u reps=%u avg=%u cycles bw=%u MB/s",
+               (u32)size, MEMBENCH_REPS, (u32)(cycles / MEMBENCH_REPS),
+               membench_bw_mb((u64)size * MEMBENCH_REPS, cycles));
+    }
+}
+
+/**
+ * @brief dcache写回/无效尺寸扫描基准
+ *
+ * @details 每次重复前先memset把范围内缓存行弄脏，只对维护操作
+ *          本身计时；尺寸跨过按行/全量切换阈值时曲线会出现
+ *          拐点，两种机型的拐点位置即缓存行为差异所在
+ *
+ * @param buf 工作缓冲（缓存行对齐）
+ * @param len 缓冲长度（字节）
+ */
+static void membench_dcache(void *buf, size_t len)
+{
+    size_t size;
+    u64 cycles;
+    u64 t0;
+    u32 i;
+
+    KLOG_I("dcache: line=%u llc=%u bytes",
+           cache_line_size_get(), (u32)cache_llc_size_get());
+
+    for (size = MEMBENCH_MIN_SIZE; size <= len; size *= 2U)
+    {
+        cycles = 0U;
+        for (i = 0U; i < MEMBENCH_REPS; i++)
+        {
+            /* 弄脏范围内的缓存行，保证写回路径有真实工作量 */
+            (void)arch_memset_fast(buf, (int)i, size);
+
+            t0 = drdtime();
+            cache_dcache_flush_adaptive((size_t)buf, size);
+            cycles += drdtime() - t0;
+        }
+
+        KLOG_I("dcache-flush: size=%u reps=%u avg=%u cycles bw=%u MB/s",
+               (u32)size, MEMBENCH_REPS, (u32)(cycles / MEMBENCH_REPS),
+               membench_bw_mb((u64)size * MEMBENCH_REPS, cycles));
+    }
+
+    for (size = MEMBENCH_MIN_SIZE; size <= len; size *= 2U)
+    {
+        cycles = 0U;
+        for (i = 0U; i < MEMBENCH_REPS; i++)
+        {
+            (void)arch_memset_fast(buf, (int)i, size);
+
+            t0 = drdtime();
+            cache_dcache_invd_adaptive((size_t)buf, size);
+            cycles += drdtime() - t0;
+        }
+
+        KLOG_I("dcache-invd: size=%u reps=%u avg=%u cycles bw=%u MB/s",
+               (u32)size, MEMBENCH_REPS, (u32)(cycles / MEMBENCH_REPS),
+               membench_bw_mb((u64)size * MEMBENCH_REPS, cycles));
+    }
+}
+
+/**
+ * @brief 原子争用基准工作函数
+ *
+ * @details 在目标核中断上下文执行：有界自旋等待放行标志，
+ *          起跑后对共享缓存行执行固定次数原子加，最后原子
+ *          推进完成计数；等待超时直接完成，不拖死发起核
+ *
+ * @param arg 未使用
+ */
+static void membench_atomic_worker(void *arg)
+{
+    u32 spin;
+    u32 i;
+
+    (void)arg;
+
+    for (spin = 0U; (spin < MEMBENCH_SPIN_MAX) && (s_atomic_go == 0); spin++)
+    {
+        smp_rmb();
+    }
+
+    if (s_atomic_go != 0)
+    {
+        for (i = 0U; i < MEMBENCH_ATOMIC_OPS; i++)
+        {
+            (void)atomic64_add(&s_atomic_counter, 1);
+        }
+    }
+
+    (void)atomic32_add(&s_atomic_done, 1);
+}
+
+/**
+ * @brief 原子操作争用吞吐基准
+ *
+ * @details 核数从1扫到使能核数：每轮把工作函数派发到前n个使能
+ *          核（不含本核，本核直接参与），统一放行后并发对同一
+ *          缓存行执行原子加，测全部完成的总周期并折算吞吐；
+ *          单核一轮即无争用基线，多核各轮反映缓存行迁移开销
+ */
+static void membench_atomic(void)
+{
+    int cpus[CONFIG_MAX_CPUS];
+    int ncpus = 0;
+    int self = (int)cpuid_get();
+    int n;
+    int i;
+    u32 spin;
+    u64 t0;
+    u64 cycles;
+    u64 total_ops;
+
+    /* 本核排第一个，保证每轮都有本核直接参与 */
+    cpus[ncpus] = self;
+    ncpus++;
+
+#if CONFIG_SMP == 1
+    for (i = 0; i < CONFIG_MAX_CPUS; i++)
+    {
+        if ((i != self) && CPU_ISSET(i, TTOS_CPUSET_ENABLED()))
+        {
+            cpus[ncpus] = i;
+            ncpus++;
+        }
+    }
+#endif
+
+    for (n = 1; n <= ncpus; n++)
+    {
+        s_atomic_counter = 0;
+        s_atomic_done = 0;
+        s_atomic_go = 0;
+        smp_wmb();
+
+        /* 先派发远端核，它们在放行标志上自旋等待 */
+        for (i = 1; i < n; i++)
+        {
+            (void)smp_call_function_single(cpus[i], membench_atomic_worker, NULL, false);
+        }
+
+        t0 = drdtime();
+        s_atomic_go = 1;
+        smp_wmb();
+
+        /* 本核直接参与争用 */
+        membench_atomic_worker(NULL);
+
+        for (spin = 0U; (spin < MEMBENCH_SPIN_MAX) && (s_atomic_done < n); spin++)
+        {
+            smp_rmb();
+        }
+        cycles = drdtime() - t0;
+
+        if (s_atomic_done < n)
+        {
+            KLOG_E("atomic64-add: cpus=%d incomplete (%d/%d)", n, s_atomic_done, n);
+            continue;
+        }
+
+        total_ops = (u64)n * MEMBENCH_ATOMIC_OPS;
+        KLOG_I("atomic64-add: cpus=%d ops=%u cycles=%u rate=%u kops/s",
+               n, (u32)total_ops, (u32)cycles,
+               (u32)((total_ops * ttos_time_freq_get()) / (cycles * 1000ULL)));
+    }
+}
+
+/**
+ * @brief 运行内存与缓存基准套件
+ *
+ * @details 依次执行memcpy/memset带宽、dcache维护尺寸扫描、
+ *          原子操作争用吞吐基准，结果经klog输出
+ *
+ * @param buf 工作缓冲起始地址（必须缓存行对齐，内容会被覆盖）
+ * @param len 工作缓冲长度（字节，不小于两倍最小扫描尺寸）
+ *
+ * @return 成功返回0，参数无效返回-EINVAL
+ */
+s32 membench_run(void *buf, size_t len)
+{
+    if ((buf == NULL) || (len < (2U * MEMBENCH_MIN_SIZE)))
+    {
+        return -EINVAL;
+    }
+
+    if (((uintptr_t)buf & 63UL) != 0UL)
+    {
+        return -EINVAL;
+    }
+
+    KLOG_I("membench: counter freq %u Hz, buf=%u bytes",
+           (u32)ttos_time_freq_get(), (u32)len);
+
+    membench_copy(buf, len);
+    membench_dcache(buf, len);
+    membench_atomic();
+
+    return 0;
+}
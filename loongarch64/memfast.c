@@ -0,0 +1,124 @@
+/**
+ * @file    memfast.c
+ * @brief   向量化内存例程运行时分发
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件按cpu_probe探测结果在LASX/LSX/标量实现间分发
+ *          - 向量例程自行在栈上保存/恢复所用向量寄存器
+ *          - 分发层负责关中断和EUEN使能位的临时打开与恢复
+ *          - 小块和无向量单元的CPU退化为标准memcpy/memset
+ *
+ * @note MISRA-C:2012 合规
+ * @note 向量段内关中断，避免中断或任务切换丢失向量寄存器内容
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+/*************************** 头文件包含 ****************************/
+#include <cpu-features.h>
+#include <cpu.h>
+#include <int.h>
+#include <memfast.h>
+#include <string.h>
+
+/*************************** 宏定义 ****************************/
+
+/*************************** 类型定义 ****************************/
+
+/*************************** 外部声明 ****************************/
+/* memALib.S中的向量例程 */
+extern void memcpy_lsx(void *dst, const void *src, size_t n);
+extern void memcpy_lasx(void *dst, const void *src, size_t n);
+extern void memset_lsx(void *dst, int value, size_t n);
+extern void memset_lasx(void *dst, int value, size_t n);
+
+/*************************** 前向声明 ****************************/
+
+/*************************** 模块变量 ****************************/
+
+/*************************** 函数实现 ****************************/
+
+/**
+ * @brief 大块内存拷贝快速路径
+ *
+ * @details 长度达到MEM_FAST_MIN且CPU支持LSX/LASX时走向量拷贝：
+ *          关中断后临时打开EUEN使能位，拷贝完成后恢复原值，
+ *          不触碰任务的惰性FPU状态
+ *
+ * @param dst 目标地址
+ * @param src 源地址
+ * @param n 拷贝字节数
+ *
+ * @return 返回dst
+ *
+ * @note 源和目标区域不得重叠
+ */
+void *arch_memcpy_fast(void *dst, const void *src, size_t n)
+{
+    irq_flags_t flags;
+    unsigned int old_euen;
+
+    if ((n < MEM_FAST_MIN) || (!cpu_has_lsx))
+    {
+        return memcpy(dst, src, n);
+    }
+
+    raw_local_irq_save(flags);
+    old_euen = csr_read32(LOONGARCH_CSR_EUEN);
+    if (cpu_has_lasx)
+    {
+        csr_write32(old_euen | CSR_EUEN_LSXEN | CSR_EUEN_LASXEN, LOONGARCH_CSR_EUEN);
+        memcpy_lasx(dst, src, n);
+    }
+    else
+    {
+        csr_write32(old_euen | CSR_EUEN_LSXEN, LOONGARCH_CSR_EUEN);
+        memcpy_lsx(dst, src, n);
+    }
+    csr_write32(old_euen, LOONGARCH_CSR_EUEN);
+    raw_local_irq_restore(flags);
+
+    return dst;
+}
+
+/**
+ * @brief 大块内存填充快速路径
+ *
+ * @details 长度达到MEM_FAST_MIN且CPU支持LSX/LASX时走向量填充：
+ *          关中断后临时打开EUEN使能位，填充完成后恢复原值
+ *
+ * @param dst 目标地址
+ * @param value 填充字节值
+ * @param n 填充字节数
+ *
+ * @return 返回dst
+ */
+void *arch_memset_fast(void *dst, int value, size_t n)
+{
+    irq_flags_t flags;
+    unsigned int old_euen;
+
+    if ((n < MEM_FAST_MIN) || (!cpu_has_lsx))
+    {
+        return memset(dst, value, n);
+    }
+
+    raw_local_irq_save(flags);
+    old_euen = csr_read32(LOONGARCH_CSR_EUEN);
+    if (cpu_has_lasx)
+    {
+        csr_write32(old_euen | CSR_EUEN_LSXEN | CSR_EUEN_LASXEN, LOONGARCH_CSR_EUEN);
+        memset_lasx(dst, value, n);
+    }
+    else
+    {
+        csr_write32(old_euen | CSR_EUEN_LSXEN, LOONGARCH_CSR_EUEN);
+        memset_lsx(dst, value, n);
+    }
+    csr_write32(old_euen, LOONGARCH_CSR_EUEN);
+    raw_local_irq_restore(flags);
+
+    return dst;
+}
@@ -0,0 +1,260 @@
+/**
+ * @file    memory_scan.c
+ * @brief   启动内存清零多核并行实现
+ * @author  Intewell Team
+ * @date    2025-08-29
+ * @version 1.0
+ *
+ * @details 本文件实现启动期大块内存清零的多核并行分发
+ *          - 登记的范围按定长块统一编号，各核经原子游标动态
+ *            认领，负载天然均衡，无需静态切分
+ *          - 每块用arch_memset_fast清零，走其向量化快速路径
+ *          - 主核原子计数汇合，配合boot_trace度量并行收益
+ *
+ * @note MISRA-C:2012 合规
+ * @note 从核侧认领循环在IPI中断上下文执行，仅限启动期
+ *       调度器接管前使用
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#define KLOG_TAG "memscan"
+
+/*************************** 头文件包含 ****************************/
+#include <atomic.h>
+#include <barrier.h>
+#include <boot-trace.h>
+#include <cpu.h>
+#include <errno.h>
+#include <ipi.h>
+#include <klog.h>
+#include <memfast.h>
+#include <memory_scan.h>
+#include <ttos.h>
+#include <ttos_time.h>
+
+/*************************** 宏定义 ****************************/
+
+
+/*************************** 数据结构 ****************************/
+
+/**
+ * @brief 已登记的清零范围
+ */
+struct memscan_range
+{
+    uintptr_t start;    /**< @brief 范围起始虚拟地址 */
+    size_t size;        /**< @brief 范围长度（字节） */
+    u32 chunk_base;     /**< @brief 首块的全局块号 */
+    u32 chunks;         /**< @brief 本范围的块数 */
+};
+
+/*************************** 模块变量 ****************************/
+/* 清零范围表（主核在分发前单线程填写） */
+static struct memscan_range s_ranges[MEM_SCAN_RANGE_MAX];
+
+/* 已登记范围数 */
+static u32 s_range_count = 0U;
+
+/* 总块数 */
+static u32 s_total_chunks = 0U;
+
+/* 认领游标：各核原子取号，号即全局块号 */
+static volatile int s_cursor = 0;
+
+/* 完成计数：每清零一块递增一次，主核据此汇合 */
+static volatile int s_done = 0;
+
+/*************************** 内部函数声明 ****************************/
+static void memscan_zero_chunk(u32 index);
+static void memscan_claim_loop(void);
+static void memscan_worker(void *arg);
+
+/*************************** 函数实现 ****************************/
+
+/**
+ * @brief 清零一个全局块
+ *
+ * @details 线性扫描范围表定位块号所属范围（范围数上限16，
+ *          代价可忽略），尾块按实际剩余长度截断
+ *
+ * @param index 全局块号
+ */
+static void memscan_zero_chunk(u32 index)
+{
+    u32 i;
+
+    for (i = 0U; i < s_range_count; i++)
+    {
+        const struct memscan_range *range = &s_ranges[i];
+
+        if ((index >= range->chunk_base) &&
+            (index < (range->chunk_base + range->chunks)))
+        {
+            size_t offset = (size_t)(index - range->chunk_base) * MEM_SCAN_CHUNK_SIZE;
+            size_t len = range->size - offset;
+
+            if (len > MEM_SCAN_CHUNK_SIZE)
+            {
+                len = MEM_SCAN_CHUNK_SIZE;
+            }
+
+            (void)arch_memset_fast((void *)(range->start + offset), 0, len);
+
+            return;
+        }
+    }
+}
+
+/**
+ * @brief 块认领循环
+ *
+ * @details 原子取号认领下一块直到耗尽；每块完成后先加存储
+ *          屏障再递增完成计数，保证主核汇合后清零结果可见
+ */
+static void memscan_claim_loop(void)
+{
+    for (;;)
+    {
+        int index = atomic32_add(&s_cursor, 1);
+
+        if ((u32)index >= s_total_chunks)
+        {
+            break;
+        }
+
+        memscan_zero_chunk((u32)index);
+
+        smp_wmb();
+        (void)atomic32_add(&s_done, 1);
+    }
+}
+
+/**
+ * @brief 从核认领入口（IPI调用）
+ *
+ * @param arg 未使用
+ */
+static void memscan_worker(void *arg)
+{
+    (void)arg;
+
+    memscan_claim_loop();
+}
+
+/**
+ * @brief 登记一段待清零内存范围
+ *
+ * @details 主核在分发前调用，范围须已建立映射；
+ *          各范围按MEM_SCAN_CHUNK_SIZE切块统一编号
+ *
+ * @param[in] start 范围起始虚拟地址
+ * @param[in] size  范围长度（字节）
+ *
+ * @return 成功返回0，范围表已满返回-ENOSPC，参数非法返回-EINVAL
+ *
+ * @retval 0 成功
+ * @retval -EINVAL 参数无效
+ * @retval -ENOSPC 范围表已满
+ */
+s32 memory_scan_add_range(uintptr_t start, size_t size)
+{
+    struct memscan_range *range;
+
+    if ((start == 0U) || (size == 0U))
+    {
+        return (-EINVAL);
+    }
+
+    if (s_range_count >= MEM_SCAN_RANGE_MAX)
+    {
+        return (-ENOSPC);
+    }
+
+    range = &s_ranges[s_range_count];
+    range->start = start;
+    range->size = size;
+    range->chunk_base = s_total_chunks;
+    range->chunks = (u32)((size + MEM_SCAN_CHUNK_SIZE - 1U) / MEM_SCAN_CHUNK_SIZE);
+
+    s_total_chunks += range->chunks;
+    s_range_count++;
+
+    return (0);
+}
+
+/**
+ * @brief 分发并行清零并参与执行
+ *
+ * @details 向除本核外所有已使能CPU发认领IPI（fire-and-forget），
+ *          随后本核也进入认领循环直到块耗尽；各核经原子游标
+ *          动态取块，天然实现地址区间负载均衡
+ *
+ * @note 须在从核拉起（smp_boot_wait_all成功）之后调用；
+ *       本树暂无NUMA拓扑数据，按地址区间切块分发
+ */
+void memory_scan_dispatch(void)
+{
+    if (s_total_chunks == 0U)
+    {
+        return;
+    }
+
+    boot_trace_mark("memscan_begin");
+
+    /* 先发布范围表，再让从核开始认领 */
+    smp_wmb();
+
+#if CONFIG_SMP == 1
+    {
+        cpu_set_t workers;
+
+        CPU_ZERO(&workers);
+        CPU_OR(&workers, &workers, TTOS_CPUSET_ENABLED());
+        CPU_CLR(cpuid_get(), &workers);
+
+        if (CPU_COUNT(&workers) > 0)
+        {
+            (void)smp_call_function_mask(&workers, memscan_worker, NULL, false);
+        }
+    }
+#endif
+
+    /* 主核参与认领，不空等 */
+    memscan_claim_loop();
+}
+
+/**
+ * @brief 等待并行清零汇合
+ *
+ * @details 主核自旋等待完成计数到达总块数，超时走drdtime
+ *          换算，汇合成功后加载屏障保证清零结果对本核可见
+ *
+ * @param[in] timeout_ms 超时时间（毫秒）
+ *
+ * @return 成功返回0，超时返回-ETIMEDOUT
+ *
+ * @retval 0 成功
+ * @retval -ETIMEDOUT 超时
+ */
+s32 memory_scan_wait(u32 timeout_ms)
+{
+    u64 deadline = drdtime() + ((ttos_time_freq_get() * (u64)timeout_ms) / 1000U);
+
+    while ((u32)s_done < s_total_chunks)
+    {
+        if (drdtime() >= deadline)
+        {
+            KLOG_E("parallel zero rendezvous timeout: %d/%u chunks",
+                   s_done, s_total_chunks);
+
+            return -ETIMEDOUT;
+        }
+        __asm__ volatile("idle 0");
+    }
+
+    smp_rmb();
+    boot_trace_mark("memscan_done");
+
+    return 0;
+}
@@ -32,7 +32,9 @@
 #include <cache.h>
 #include <commonUtils.h>
 #include <cpu.h>
+#include <int.h>
 #include <inttypes.h>
+#include <ipi.h>
 #include <memblock.h>
 #include <mmu.h>
 #include <page.h>
@@ -60,16 +62,13 @@ extern int __executable_start;
 #define VA_RAM_BASE ((virt_addr_t)vm_map_base)
 #define VA_RAM_END (VA_RAM_BASE + ((max_low_pfn - min_low_pfn + 1) << PAGE_SIZE_SHIFT))
 static DEFINE_SPINLOCK(ptable_lock);
-static DEFINE_SPINLOCK(fixmap_lock);
-static DEFINE_SPINLOCK(ktmp_access_lock);
 static void mmu_table_flush(virt_addr_t vaddr);
+extern void uaccess_tlb_flush_all(void);
 virt_addr_t loongarch_alloc_vaddr(struct mm *mm, size_t page_count);
 static virt_addr_t loongarch_alloc_vaddr_with_min(struct mm *mm, size_t page_count, virt_addr_t map_min);
 static int mmu_map_r(struct mm *mm, virt_addr_t va, phys_addr_t pa, size_t size, uint64_t attr);
 static int loongarch_mmu_unmap(struct mm *mm, struct mm_region *region);
 static uint64_t attr_2_mmu(uint64_t attr);
-static fixmap_set_t fixmap_pool;
-int g_last_fixmap = FIX_MAP_POOL_START;
 static bool is_large_page(uint64_t val)
 {
     if (val & _PAGE_HUGE)
@@ -102,50 +101,22 @@ virt_addr_t fix_map_set(int idx, phys_addr_t phy, uint64_t prot)
     cache_dcache_invalidate(vaddr, PAGE_SIZE);
     return vaddr;
 }
-static int fixmap_alloc(void)
-{
-    int fixmap;
-    long flags;
-    spin_lock_irqsave(&fixmap_lock, flags);
-    while (FIXMAP_ISSET(g_last_fixmap, &fixmap_pool))
-    {
-        g_last_fixmap++;
-        if (g_last_fixmap == FIXMAP_SETSIZE)
-        {
-            g_last_fixmap = FIX_MAP_POOL_START;
-        }
-    };
-#ifdef FIX_MAP_USER_HLEPER
-    if (unlikely(g_last_fixmap == FIX_MAP_USER_HLEPER))
-    {
-        FIXMAP_SET(g_last_fixmap, &fixmap_pool);
-        g_last_fixmap++;
-    }
-#endif
-    FIXMAP_SET(g_last_fixmap, &fixmap_pool);
-    fixmap = g_last_fixmap++;
-    if (g_last_fixmap == FIXMAP_SETSIZE)
-    {
-        g_last_fixmap = FIX_MAP_POOL_START;
-    }
-    spin_unlock_irqrestore(&fixmap_lock, flags);
-    return fixmap;
-}
-static void fixmap_free(int fixmap)
-{
-    long flags;
-    spin_lock_irqsave(&fixmap_lock, flags);
-    FIXMAP_CLR(fixmap, &fixmap_pool);
-    spin_unlock_irqrestore(&fixmap_lock, flags);
-}
 virt_addr_t fix_map_vaddr(phys_addr_t idx)
 {
     return FIX_MAP_START + idx;
 }
-static int fix_map_index(virt_addr_t vaddr)
-{
-    return (vaddr - FIX_MAP_START) >> PAGE_SIZE_SHIFT;
-}
+/**
+ * @brief 建立对任意物理页的临时内核访问
+ *
+ * @details 优先走线性映射；线性映射外的物理页经DMW1直写窗口
+ *          访问：窗口地址由基址加物理地址直接算出，不改页表、
+ *          不动TLB（直写窗口不经TLB翻译），各核完全无共享状态，
+ *          无需任何锁或槽位分配
+ *
+ * @param paddr 目标物理页地址
+ *
+ * @return 可访问该物理页的内核虚拟地址
+ */
 virt_addr_t ktmp_access_start(phys_addr_t paddr)
 {
     virt_addr_t vaddr;
@@ -154,23 +125,39 @@ virt_addr_t ktmp_access_start(phys_addr_t paddr)
     {
         return vaddr;
     }
-    int fixmap = fixmap_alloc();
-    return fix_map_set(fixmap, paddr, MT_KERNEL_MEM);
+    vaddr = fix_map_vaddr(paddr);
+    /* 别名一致性：丢弃窗口别名上的陈旧缓存行后再访问 */
+    cache_dcache_invalidate(vaddr, PAGE_SIZE);
+    return vaddr;
 }
+/**
+ * @brief 结束对物理页的临时访问
+ *
+ * @details 线性映射地址无需处理；窗口别名写回缓存，
+ *          保证修改对其他映射别名与DMA可见
+ *
+ * @param vaddr ktmp_access_start返回的虚拟地址
+ */
 void ktmp_access_end(virt_addr_t vaddr)
 {
-    if (vaddr >= fix_map_vaddr(FIX_MAP_POOL_START))
+    if (vaddr >= FIX_MAP_START)
     {
-        int idx = fix_map_index(vaddr);
-        fixmap_free(idx);
-        fix_map_set(idx, 0, 0);
+        cache_dcache_clean(vaddr, PAGE_SIZE);
     }
 }
-static phys_addr_t ptable_alloc(void)
+/* per-CPU页表页缓存池：常见路径的页表页分配/释放不再触碰全局分配器 */
+#define PTABLE_CACHE_MAX 16   /* 单核缓存的空闲页表页上限 */
+#define PTABLE_CACHE_BATCH 8  /* 与全局分配器批量交换的页数 */
+struct ptable_cache
+{
+    phys_addr_t page[PTABLE_CACHE_MAX];
+    int count;
+};
+static struct ptable_cache ptable_cache[CONFIG_MAX_CPUS] __attribute__((aligned(64)));
+static phys_addr_t ptable_alloc_slow(void)
 {
     if (page_allocer_inited())
     {
-        //        return pages_alloc(0, ZONE_ANYWHERE);
         phys_addr_t addr = pages_alloc(0, ZONE_ANYWHERE);
         printUart("[%s:%u] addr:%p, PGDL:%p\n", __func__, __LINE__, addr, csr_read64(LOONGARCH_CSR_PGDL));
         return addr;
@@ -180,7 +167,7 @@ static phys_addr_t ptable_alloc(void)
     printUart("[%s:%u] addr:%p, PGDL:%p\n", __func__, __LINE__, addr, csr_read64(LOONGARCH_CSR_PGDL));
     return addr;
 }
-static void ptable_free(phys_addr_t phy)
+static void ptable_free_slow(phys_addr_t phy)
 {
     if (page_allocer_inited())
     {
@@ -191,6 +178,150 @@ static void ptable_free(phys_addr_t phy)
     ttos_memblk_free(phy, PAGE_SIZE);
     printUart("[%s:%u] addr:%p, PGDL:%p\n", __func__, __LINE__, phy, csr_read64(LOONGARCH_CSR_PGDL));
 }
+static phys_addr_t ptable_alloc(void)
+{
+    struct ptable_cache *cache;
+    phys_addr_t addr;
+    irq_flags_t flags;
+    /* memblock阶段只有启动核运行，直接走全局分配器 */
+    if (!page_allocer_inited())
+    {
+        return ptable_alloc_slow();
+    }
+    /* 关中断后访问本核缓存，期间不会发生迁移，无需全局锁 */
+    raw_local_irq_save(flags);
+    cache = &ptable_cache[csr_read32(LOONGARCH_CSR_CPUID)];
+    if (cache->count == 0)
+    {
+        /* 本核缓存耗尽，批量从全局分配器取页回填 */
+        while (cache->count < PTABLE_CACHE_BATCH)
+        {
+            addr = pages_alloc(0, ZONE_ANYWHERE);
+            if (!addr)
+            {
+                break;
+            }
+            cache->page[cache->count++] = addr;
+        }
+        if (cache->count == 0)
+        {
+            raw_local_irq_restore(flags);
+            return 0;
+        }
+    }
+    addr = cache->page[--cache->count];
+    raw_local_irq_restore(flags);
+    return addr;
+}
+/* per-表有效项计数缓存：以页表物理页号散列，ptable_entry_set置位/清位
+ * 时在ptable_lock内增减计数，回收判断由全表512项扫描变为O(1)读数。
+ * 槽位冲突时新表直接接管，被挤出的表退回慢路径扫描（扫描后回填），
+ * 静态页表（内核根表、fixmap表）不在缓存中，同样走扫描路径 */
+#define PTCNT_SLOTS 256U
+struct ptcnt
+{
+    phys_addr_t page; /* 页表物理页地址（0为空槽） */
+    int count;        /* 表内非零项数 */
+};
+static struct ptcnt s_ptcnt[PTCNT_SLOTS];
+static struct ptcnt *ptcnt_slot(phys_addr_t pte)
+{
+    return &s_ptcnt[(pte >> PAGE_SIZE_SHIFT) & (PTCNT_SLOTS - 1U)];
+}
+static void ptcnt_drop(phys_addr_t phy)
+{
+    irq_flags_t flags;
+    struct ptcnt *pc = ptcnt_slot(phy);
+    spin_lock_irqsave(&ptable_lock, flags);
+    if (pc->page == phy)
+    {
+        pc->page = 0;
+        pc->count = 0;
+    }
+    spin_unlock_irqrestore(&ptable_lock, flags);
+}
+static void ptable_free(phys_addr_t phy)
+{
+    struct ptable_cache *cache;
+    irq_flags_t flags;
+    /* 页表页即将回收复用，先撤销其计数缓存 */
+    ptcnt_drop(phy);
+    if (!page_allocer_inited())
+    {
+        ptable_free_slow(phy);
+        return;
+    }
+    raw_local_irq_save(flags);
+    cache = &ptable_cache[csr_read32(LOONGARCH_CSR_CPUID)];
+    if (cache->count == PTABLE_CACHE_MAX)
+    {
+        /* 本核缓存已满，批量向全局分配器回填一半，避免空闲页囤积 */
+        while (cache->count > (PTABLE_CACHE_MAX - PTABLE_CACHE_BATCH))
+        {
+            pages_free(cache->page[--cache->count], 0);
+        }
+    }
+    cache->page[cache->count++] = phy;
+    raw_local_irq_restore(flags);
+}
+/* 延迟页表回收：unmap路径摘除表项后不立即归还页表页，而是挂入本核
+ * 延迟队列；待一次全核同步IPI静默点（所有核都已离开当时正在进行的
+ * 页表遍历/缺页处理）后批量归还，避免其他核在旧表页上游走时页面
+ * 被复用，同时把逐页归还合并成一次批处理 */
+#define PTDEFER_MAX 64
+struct ptdefer_q
+{
+    phys_addr_t page[PTDEFER_MAX];
+    int count;
+} __attribute__((aligned(64)));
+static struct ptdefer_q s_ptdefer[CONFIG_MAX_CPUS];
+static void ptdefer_quiesce_fn(void *arg)
+{
+    (void)arg; /* 空函数：IPI往返本身即静默点确认 */
+}
+static void ptable_defer_flush(void)
+{
+    struct ptdefer_q *q;
+    irq_flags_t flags;
+    phys_addr_t pages[PTDEFER_MAX];
+    int i, count;
+    raw_local_irq_save(flags);
+    q = &s_ptdefer[csr_read32(LOONGARCH_CSR_CPUID)];
+    count = q->count;
+    for (i = 0; i < count; i++)
+    {
+        pages[i] = q->page[i];
+    }
+    q->count = 0;
+    raw_local_irq_restore(flags);
+    if (count == 0)
+    {
+        return;
+    }
+    /* 同步空调用IPI确认所有核经过静默点，之后旧表页不再被引用 */
+    (void)smp_call_function_mask(NULL, ptdefer_quiesce_fn, NULL, true);
+    for (i = 0; i < count; i++)
+    {
+        ptable_free(pages[i]);
+    }
+}
+static void ptable_free_deferred(phys_addr_t phy)
+{
+    struct ptdefer_q *q;
+    irq_flags_t flags;
+    raw_local_irq_save(flags);
+    q = &s_ptdefer[csr_read32(LOONGARCH_CSR_CPUID)];
+    if (q->count == PTDEFER_MAX)
+    {
+        /* 队列满：先排空（含静默等待）再入队 */
+        raw_local_irq_restore(flags);
+        ptable_defer_flush();
+        raw_local_irq_save(flags);
+        q = &s_ptdefer[csr_read32(LOONGARCH_CSR_CPUID)];
+    }
+    q->page[q->count++] = phy;
+    raw_local_irq_restore(flags);
+}
 static uint64_t *ptable_get(phys_addr_t pte, int level, irq_flags_t *flags)
 {
     spin_lock_irqsave(&ptable_lock, *flags);
@@ -212,7 +343,17 @@ static void ptable_entry_set(phys_addr_t pte, int level, int idx, uint64_t value
 {
     irq_flags_t flags;
     uint64_t *table = ptable_get(pte, level, &flags);
+    uint64_t old = table[idx];
     table[idx] = value;
+    /* 零与非零间切换时维护per-表有效项计数（已持ptable_lock） */
+    if ((old != 0) != (value != 0))
+    {
+        struct ptcnt *pc = ptcnt_slot(pte);
+        if (pc->page == pte)
+        {
+            pc->count += (value != 0) ? 1 : -1;
+        }
+    }
     ptable_put(&flags);
 }
 static uint64_t ptable_entry_get(phys_addr_t pte, int level, int idx)
@@ -227,15 +368,29 @@ static uint64_t ptable_entry_get(phys_addr_t pte, int level, int idx)
 static void ptable_clear(phys_addr_t pte, int level)
 {
     irq_flags_t flags;
+    struct ptcnt *pc;
     uint64_t *table = ptable_get(pte, level, &flags);
     memset(table, 0, PAGE_SIZE);
+    /* 新建的空表从0开始计数，槽位冲突时直接接管 */
+    pc = ptcnt_slot(pte);
+    pc->page = pte;
+    pc->count = 0;
     ptable_put(&flags);
 }
 static int ptable_valid_num(phys_addr_t pte, int level)
 {
     int i, count = 0;
     irq_flags_t flags;
+    struct ptcnt *pc;
     uint64_t *table = ptable_get(pte, level, &flags);
+    pc = ptcnt_slot(pte);
+    if (pc->page == pte)
+    {
+        count = pc->count;
+        ptable_put(&flags);
+        return count;
+    }
+    /* 缓存未命中（静态表或被冲突挤出）：扫描后回填计数 */
     for (i = 0; i < 512; i++)
     {
         if (table[i] != 0)
@@ -243,6 +398,8 @@ static int ptable_valid_num(phys_addr_t pte, int level)
             count++;
         }
     }
+    pc->page = pte;
+    pc->count = count;
     ptable_put(&flags);
     return count;
 }
@@ -426,7 +583,7 @@ static size_t ummap_single_entry_r(struct mm *mm, virt_addr_t va, size_t size, b
                     if (ptable_valid_num(pte_lv[level], level) == 0)
                     {
                         printUart("[%s:%lu] ptable_free() begin\n", __func__, __LINE__);
-                        ptable_free(pte_lv[level]);
+                        ptable_free_deferred(pte_lv[level]);
                         printUart("[%s:%lu] ptable_free() end %p\n", __func__, __LINE__, pte_lv[level]);
                         /* 如果当前表已为空表则需要对上级表的引用计数-1并删除表 */
                         int __release_level = level - 1;
@@ -439,7 +596,7 @@ static size_t ummap_single_entry_r(struct mm *mm, virt_addr_t va, size_t size, b
                                 (__release_level != mm->first_level))
                             {
                                 printUart("[%s:%lu] ptable_free() begin\n", __func__, __LINE__);
-                                ptable_free(pte_lv[__release_level]);
+                                ptable_free_deferred(pte_lv[__release_level]);
                                 printUart("[%s:%lu] ptable_free() end %p\n", __func__, __LINE__,
                                           pte_lv[__release_level]);
                             }
@@ -480,36 +637,52 @@ static int mmu_unmap_r(struct mm *mm, virt_addr_t va, size_t size)
     }
     return 0;
 }
+/* 大页聚合映射的最高级别：level1=1GB level2=2MB，level0块映射硬件不支持 */
+#define MMU_MAP_BLOCK_LEVEL_MIN 1
+/* 为当前va/pa/剩余size选择最大可用的映射粒度（2MB/1GB大页自动聚合） */
+static int mmu_map_level_select(virt_addr_t va, phys_addr_t pa, size_t size)
+{
+    int level;
+    for (level = MMU_MAP_BLOCK_LEVEL_MIN; level < MAX_TABLE_LEVEL; level++)
+    {
+        if (IS_LEVEL_ALIGN(level, va) && IS_LEVEL_ALIGN(level, pa) && (size >= LEVEL_SIZE(level)))
+        {
+            return level;
+        }
+    }
+    return MAX_TABLE_LEVEL;
+}
 static int mmu_map_r(struct mm *mm, virt_addr_t va, phys_addr_t pa, size_t size, uint64_t attr)
 {
-    size_t i;
-    size_t count;
     int level;
     int ret;
-    level = GET_MAP_LEVEL(va, pa, size);
-    // TODO:jcai ummap_single_entry_r() 中通过 MAX_TABLE_LEVEL 强制使用4级页表
-    // 所以这里也强制使用4级页表，这是临时修改
-    level = MAX_TABLE_LEVEL;
-    count = size >> LEVEL_SIZE_SHIFT(level);
-    if (!IS_LEVEL_ALIGN(level, pa))
+    if (!IS_LEVEL_ALIGN(MAX_TABLE_LEVEL, pa))
     {
         return -1;
     }
-    if (!IS_LEVEL_ALIGN(level, va))
+    if (!IS_LEVEL_ALIGN(MAX_TABLE_LEVEL, va))
     {
         return -1;
     }
-    for (i = 0; i < count; i++)
+    if (!IS_LEVEL_ALIGN(MAX_TABLE_LEVEL, size))
     {
+        return -1;
+    }
+    while (size)
+    {
+        /* 虚实地址与剩余长度均满足对齐时自动升级为2MB/1GB块映射，
+         * 解映射路径由ummap_single_entry_r()负责大页拆分回退 */
+        level = mmu_map_level_select(va, pa, size);
         ret = map_single_entry_r(mm, level, va, pa, attr);
         mmu_table_flush(va);
-        va += LEVEL_SIZE(level);
-        pa += LEVEL_SIZE(level);
         if (ret != 0)
         {
             mmu_table_flush(0);
             return ret;
         }
+        va += LEVEL_SIZE(level);
+        pa += LEVEL_SIZE(level);
+        size -= LEVEL_SIZE(level);
     }
     mmu_table_flush(0);
     return 0;
@@ -570,25 +743,78 @@ virt_addr_t loongarch_alloc_vaddr(struct mm *mm, size_t page_count)
 {
     return loongarch_alloc_vaddr_with_min(mm, page_count, 0);
 }
-static virt_addr_t loongarch_alloc_vaddr_with_min(struct mm *mm, size_t page_count, virt_addr_t map_min)
+/* per-mm虚拟地址分配索引：滚动游标 + 近期空洞缓存。struct mm由上层定义
+ * 无法扩展字段，故以mm指针散列到本文件的旁路表；缓存只提供候选地址，
+ * 所有候选仍经mmu_v2p_r逐页核验，region链表与页表保持权威记录，
+ * 缓存项过期或槽位被其他mm复用仅退化为重新扫描，不影响正确性 */
+#define VA_CACHE_SLOTS 16U
+#define VA_HOLE_SLOTS 8U
+struct va_hole
 {
-    virt_addr_t va, find_va = 0;
-    int n = 0;
-    virt_addr_t va_start, va_end;
-    if (mm->mm_region_type == MM_REGION_TYPE_KERNEL)
+    virt_addr_t va;
+    size_t pages;
+};
+struct va_cache
+{
+    struct mm *mm;          /* 归属mm（槽位冲突时直接覆盖） */
+    virt_addr_t next_hint;  /* 上次分配结束位置 */
+    struct va_hole hole[VA_HOLE_SLOTS];
+};
+static struct va_cache s_va_cache[VA_CACHE_SLOTS];
+static struct va_cache *va_cache_get(struct mm *mm)
+{
+    struct va_cache *vc = &s_va_cache[((uintptr_t)mm >> 6U) & (VA_CACHE_SLOTS - 1U)];
+    if (vc->mm != mm)
     {
-        va_start = map_min ? map_min : vm_map_base;
-        va_end = ((UL(1) << ARCH_VADDRESS_WIDTH_BITS) - 1) + vm_map_base;
+        memset(vc, 0, sizeof(*vc));
+        vc->mm = mm;
     }
-    else
+    return vc;
+}
+static void va_cache_drop(struct mm *mm)
+{
+    struct va_cache *vc = &s_va_cache[((uintptr_t)mm >> 6U) & (VA_CACHE_SLOTS - 1U)];
+    if (vc->mm == mm)
     {
-        va_start = map_min ? map_min : USER_SPACE_START;
-        if (va_start < MMAP_START_VADDR)
+        memset(vc, 0, sizeof(*vc));
+    }
+}
+static void va_cache_hole_put(struct mm *mm, virt_addr_t va, size_t pages)
+{
+    struct va_cache *vc = va_cache_get(mm);
+    size_t i, victim = 0;
+    for (i = 0; i < VA_HOLE_SLOTS; i++)
+    {
+        if (vc->hole[i].pages == 0)
         {
-            va_start = MMAP_START_VADDR;
+            victim = i;
+            break;
+        }
+        /* 槽满时淘汰最小的空洞（大空洞能满足更多后续分配） */
+        if (vc->hole[i].pages < vc->hole[victim].pages)
+        {
+            victim = i;
+        }
+    }
+    vc->hole[victim].va = va;
+    vc->hole[victim].pages = pages;
+}
+static bool va_range_is_free(struct mm *mm, virt_addr_t va, size_t page_count)
+{
+    size_t i;
+    for (i = 0; i < page_count; i++)
+    {
+        if (mmu_v2p_r(mm, va + (i << PAGE_SIZE_SHIFT)) != 0ULL)
+        {
+            return false;
         }
-        va_end = USER_SPACE_END;
     }
+    return true;
+}
+static virt_addr_t va_scan(struct mm *mm, virt_addr_t va_start, virt_addr_t va_end, size_t page_count)
+{
+    virt_addr_t va, find_va = 0;
+    int n = 0;
     for (va = va_start; va < va_end; va += PAGE_SIZE)
     {
         /* skip kernel linear map table */
@@ -619,6 +845,59 @@ static virt_addr_t loongarch_alloc_vaddr_with_min(struct mm *mm, size_t page_cou
     }
     return -1;
 }
+static virt_addr_t loongarch_alloc_vaddr_with_min(struct mm *mm, size_t page_count, virt_addr_t map_min)
+{
+    virt_addr_t find_va;
+    virt_addr_t va_start, va_end;
+    struct va_cache *vc;
+    size_t i;
+    if (mm->mm_region_type == MM_REGION_TYPE_KERNEL)
+    {
+        va_start = map_min ? map_min : vm_map_base;
+        va_end = ((UL(1) << ARCH_VADDRESS_WIDTH_BITS) - 1) + vm_map_base;
+    }
+    else
+    {
+        va_start = map_min ? map_min : USER_SPACE_START;
+        if (va_start < MMAP_START_VADDR)
+        {
+            va_start = MMAP_START_VADDR;
+        }
+        va_end = USER_SPACE_END;
+    }
+    vc = va_cache_get(mm);
+    /* 1. 优先复用近期释放的空洞：命中时只需核验page_count页 */
+    for (i = 0; i < VA_HOLE_SLOTS; i++)
+    {
+        struct va_hole *h = &vc->hole[i];
+        if (h->pages >= page_count && h->va >= va_start &&
+            (h->va + (page_count << PAGE_SIZE_SHIFT)) <= va_end &&
+            va_range_is_free(mm, h->va, page_count))
+        {
+            find_va = h->va;
+            h->va += page_count << PAGE_SIZE_SHIFT;
+            h->pages -= page_count;
+            return find_va;
+        }
+    }
+    /* 2. 从上次分配结束处继续扫描，跳过已密集占用的低地址区 */
+    if (vc->next_hint > va_start && vc->next_hint < va_end)
+    {
+        find_va = va_scan(mm, vc->next_hint, va_end, page_count);
+        if (find_va != (virt_addr_t)-1)
+        {
+            vc->next_hint = find_va + (page_count << PAGE_SIZE_SHIFT);
+            return find_va;
+        }
+    }
+    /* 3. 回绕到区间起点完整扫描，成功率与原线性算法等价 */
+    find_va = va_scan(mm, va_start, va_end, page_count);
+    if (find_va != (virt_addr_t)-1)
+    {
+        vc->next_hint = find_va + (page_count << PAGE_SIZE_SHIFT);
+    }
+    return find_va;
+}
 void pat_init(void)
 {
     /* TODO LOONGARCH */
@@ -705,6 +984,8 @@ static int loongarch_mmu_deinit(struct mm *mm)
         ptable_free(mm->mmu_table_base);
         printUart("[%s:%lu] ptable_free() end %p\n", __func__, __LINE__, mm->mmu_table_base);
     }
+    /* 地址空间销毁时丢弃其分配缓存，防止槽位被后继mm误复用旧提示 */
+    va_cache_drop(mm);
     return 0;
 }
 static int loongarch_mmu_switch_space(struct mm *from, struct mm *to)
@@ -733,10 +1014,9 @@ static int loongarch_mmu_switch_space(struct mm *from, struct mm *to)
         mmu_table_flush(0);
         break;
     case MM_REGION_TYPE_USER:
-        /* TODO LOONGARCH */
+        /* 切换页表基址并激活ASID，TLB按ASID隔离，无需全量刷新 */
         csr_write64(to->mmu_table_base, LOONGARCH_CSR_PGDL);
-        csr_write64(to->asid, LOONGARCH_CSR_ASID);
-        mmu_table_flush(0);
+        csr_write64(tlb_asid_activate(to), LOONGARCH_CSR_ASID);
         printUart("[%s:%d]c%d %s(%p) asid = 0x%llx, pgdl = %p\n", __FUNCTION__, __LINE__,
                   csr_read32(LOONGARCH_CSR_CPUID), ttosGetRunningTaskName(), ttosGetRunningTask(), to->asid,
                   to->mmu_table_base);
@@ -752,6 +1032,11 @@ int kmap(virt_addr_t va, phys_addr_t pa, size_t size, uint64_t attr)
     attr = attr_2_mmu(attr);
     return mmu_map_r(gp_kernel_mm, va, pa, size, attr);
 }
+/* 查内核页表把内核虚拟地址折算成物理地址（gp_kernel_mm为本文件私有） */
+phys_addr_t kernel_v2p(virt_addr_t va)
+{
+    return mmu_v2p_r(gp_kernel_mm, va);
+}
 static int loongarch_mmu_map(struct mm *mm, struct mm_region *region)
 {
     uint64_t attr;
@@ -795,11 +1080,28 @@ static int loongarch_mmu_modify(struct mm *mm, struct mm_region *region)
         size -= modify_size;
         va += modify_size;
     }
+    if (mm->mm_region_type == MM_REGION_TYPE_USER)
+    {
+        /* 用户页表属性已变更，使用户访问软件快表失效 */
+        uaccess_tlb_flush_all();
+    }
     return 0;
 }
 static int loongarch_mmu_unmap(struct mm *mm, struct mm_region *region)
 {
     int ret = mmu_unmap_r(mm, region->virtual_address, region->region_page_count * mm->page_size);
+    if (ret == 0)
+    {
+        /* 释放区间记入空洞缓存，后续同尺寸分配可直接复用 */
+        va_cache_hole_put(mm, region->virtual_address, region->region_page_count);
+    }
+    if (mm->mm_region_type == MM_REGION_TYPE_USER)
+    {
+        /* 用户映射已解除，使用户访问软件快表失效 */
+        uaccess_tlb_flush_all();
+    }
+    /* 静默点后批量归还本次unmap摘下的页表页 */
+    ptable_defer_flush();
     return ret;
 }
 /* 通过查mmu映射表，找到v_addr映射的物理地址 */
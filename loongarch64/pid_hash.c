@@ -0,0 +1,269 @@
+/**
+ * @file    pid_hash.c
+ * @brief   pid到PCB的哈希索引实现
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件实现pid→pcb哈希索引与per-CPU当前进程指针
+ *          - 固定桶数组加静态节点池，无动态分配
+ *          - 写侧（创建/退出）持自旋锁串行化；读侧无锁：
+ *            插入采用头插并先发布节点内容再挂链，摘除只改前驱
+ *            指针，遍历中的读者要么看到完整新节点要么看不到
+ *          - per-CPU当前进程槽位缓存行对齐，避免伪共享
+ *
+ * @note MISRA-C:2012 合规
+ * @note 查找为性能关键路径：无参数检查，无锁无屏障开销之外零额外分支
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+/*************************** 头文件包含 ****************************/
+#include <barrier.h>
+#include <cpu.h>
+#include <errno.h>
+#include <pid-hash.h>
+#include <spinlock.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*************************** 宏定义 ****************************/
+/* 哈希桶位数 */
+#define PID_HASH_BITS 9U
+
+/* 哈希桶数量（2的幂，300+常驻进程下平均链长约1） */
+#define PID_HASH_BUCKETS (1U << PID_HASH_BITS)
+
+/* 桶索引掩码 */
+#define PID_HASH_MASK (PID_HASH_BUCKETS - 1U)
+
+/* 静态节点池容量 */
+#define PID_HASH_NODE_MAX 1024U
+
+/*************************** 数据结构 ****************************/
+/**
+ * @brief 哈希节点
+ */
+struct pid_hash_node
+{
+    struct pid_hash_node *next; /**< @brief 桶内链表后继 */
+    pid_t pid;                  /**< @brief 进程ID */
+    pcb_t pcb;                  /**< @brief 进程控制块指针 */
+};
+
+/**
+ * @brief per-CPU当前进程槽位
+ *
+ * @details 缓存行对齐，各CPU独立写，避免伪共享
+ */
+struct pid_current_slot
+{
+    pcb_t pcb; /**< @brief 本CPU当前进程 */
+} __attribute__((aligned(64)));
+
+/*************************** 模块变量 ****************************/
+/* 桶数组：读侧无锁遍历 */
+static struct pid_hash_node *volatile s_pid_buckets[PID_HASH_BUCKETS];
+
+/* 静态节点池与空闲链 */
+static struct pid_hash_node s_pid_nodes[PID_HASH_NODE_MAX];
+static struct pid_hash_node *s_pid_free;
+static bool s_pid_pool_init;
+
+/* 写侧串行化锁（只保护插入/摘除和节点池） */
+static DEFINE_SPINLOCK(pid_hash_lock);
+
+/* per-CPU当前进程指针 */
+static struct pid_current_slot s_pid_current[CONFIG_MAX_CPUS];
+
+/*************************** 函数实现 ****************************/
+
+/**
+ * @brief 计算pid的桶索引
+ *
+ * @param pid 进程ID
+ *
+ * @return 桶索引
+ */
+static inline unsigned int pid_hash_index(pid_t pid)
+{
+    /* 乘法散列：黄金分割常数打散连续pid */
+    return ((unsigned int)pid * 0x9E3779B9U) >> (32U - PID_HASH_BITS);
+}
+
+/**
+ * @brief 惰性初始化节点池空闲链
+ *
+ * @note 必须在pid_hash_lock保护下调用
+ */
+static void pid_hash_pool_init(void)
+{
+    unsigned int i;
+
+    for (i = 0U; i < (PID_HASH_NODE_MAX - 1U); i++)
+    {
+        s_pid_nodes[i].next = &s_pid_nodes[i + 1U];
+    }
+    s_pid_nodes[PID_HASH_NODE_MAX - 1U].next = NULL;
+    s_pid_free = &s_pid_nodes[0];
+    s_pid_pool_init = true;
+}
+
+/**
+ * @brief 注册pid到PCB的映射
+ *
+ * @details 进程创建路径调用；头插新节点：先填充内容并写屏障发布，
+ *          再挂到桶头，保证无锁读者不会看到半初始化节点
+ *
+ * @param pid 进程ID
+ * @param pcb 进程控制块指针
+ *
+ * @return 成功返回0，节点池耗尽返回-ENOMEM，参数无效返回-EINVAL
+ */
+int pid_hash_insert(pid_t pid, pcb_t pcb)
+{
+    struct pid_hash_node *node = NULL;
+    unsigned long flags = 0UL;
+    unsigned int idx;
+
+    if (pcb == NULL)
+    {
+        return -EINVAL;
+    }
+
+    idx = pid_hash_index(pid) & PID_HASH_MASK;
+
+    spin_lock_irqsave(&pid_hash_lock, flags);
+
+    if (!s_pid_pool_init)
+    {
+        pid_hash_pool_init();
+    }
+
+    node = s_pid_free;
+    if (node == NULL)
+    {
+        spin_unlock_irqrestore(&pid_hash_lock, flags);
+
+        return -ENOMEM;
+    }
+    s_pid_free = node->next;
+
+    node->pid = pid;
+    node->pcb = pcb;
+    node->next = s_pid_buckets[idx];
+
+    /* 先发布节点内容，再挂到桶头对读者可见 */
+    smp_wmb();
+    s_pid_buckets[idx] = node;
+
+    spin_unlock_irqrestore(&pid_hash_lock, flags);
+
+    return 0;
+}
+
+/**
+ * @brief 注销pid映射
+ *
+ * @details 进程退出路径调用；摘链只改前驱的next指针，
+ *          正在遍历的无锁读者要么已越过该节点要么顺新链继续
+ *
+ * @param pid 进程ID
+ *
+ * @return 成功返回0，未找到返回-ESRCH
+ */
+int pid_hash_remove(pid_t pid)
+{
+    struct pid_hash_node *node = NULL;
+    struct pid_hash_node *prev = NULL;
+    unsigned long flags = 0UL;
+    unsigned int idx;
+
+    idx = pid_hash_index(pid) & PID_HASH_MASK;
+
+    spin_lock_irqsave(&pid_hash_lock, flags);
+
+    node = s_pid_buckets[idx];
+    while (node != NULL)
+    {
+        if (node->pid == pid)
+        {
+            if (prev == NULL)
+            {
+                s_pid_buckets[idx] = node->next;
+            }
+            else
+            {
+                prev->next = node->next;
+            }
+
+            /* 摘除对读者可见后再回收节点 */
+            smp_wmb();
+            node->pcb = NULL;
+            node->next = s_pid_free;
+            s_pid_free = node;
+
+            spin_unlock_irqrestore(&pid_hash_lock, flags);
+
+            return 0;
+        }
+        prev = node;
+        node = node->next;
+    }
+
+    spin_unlock_irqrestore(&pid_hash_lock, flags);
+
+    return -ESRCH;
+}
+
+/**
+ * @brief 按pid查找PCB
+ *
+ * @details 性能关键路径：无锁沿桶链遍历，平均链长约1，
+ *          ptrace attach风暴下查找开销不随进程数线性放大
+ *
+ * @param pid 进程ID
+ *
+ * @return 成功返回PCB指针，未找到返回NULL
+ */
+pcb_t pid_hash_lookup(pid_t pid)
+{
+    struct pid_hash_node *node = s_pid_buckets[pid_hash_index(pid) & PID_HASH_MASK];
+
+    while (node != NULL)
+    {
+        if (node->pid == pid)
+        {
+            return node->pcb;
+        }
+        node = node->next;
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief 更新本CPU的当前进程指针
+ *
+ * @details 上下文切换路径调用，只写本CPU槽位，无需加锁
+ *
+ * @param pcb 当前进程控制块指针
+ *
+ * @return 无
+ */
+void pid_current_set(pcb_t pcb)
+{
+    s_pid_current[cpuid_get()].pcb = pcb;
+}
+
+/**
+ * @brief 获取本CPU的当前进程指针
+ *
+ * @details 性能关键路径：per-CPU槽位直取，零查找开销
+ *
+ * @return 当前进程PCB指针，未设置时返回NULL
+ */
+pcb_t pid_current_get(void)
+{
+    return s_pid_current[cpuid_get()].pcb;
+}
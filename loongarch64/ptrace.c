@@ -16,12 +16,20 @@
  */
 /*************************** 头文件包含 ****************************/
 #include <arch/loongarch64/arch-uaccess.h>
+#include <arch/loongarch64/context.h>
+#include <arch/loongarch64/hw-breakpoint.h>
 #include <arch/loongarch64/ptrace.h>
+#include <arch/loongarch64/pid-hash.h>
 #include <errno.h>
 #include <ptrace/ptrace.h>
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/ptrace.h>
+/*************************** 宏定义 ****************************/
+/* 批量内存传输的分段粒度：按4KB基本页跨界分段，
+ * 每段不越过页边界，缺页与访问校验以页为粒度处理 */
+#define PTRACE_PAGE_SIZE 4096U
 /*************************** 类型定义 ****************************/
 /**
  * @brief iovec 结构（用于寄存器集合传输）
@@ -33,6 +41,19 @@ struct iovec
     void *iov_base; /**< @brief 缓冲区基地址 */
     size_t iov_len; /**< @brief 缓冲区长度 */
 };
+
+/*
+ * 布局契约校验：arch_context的保存前缀必须与导出的
+ * user_regs_struct逐字段一致，regset零拷贝路径依赖该前缀
+ * 直接对异常帧整组搬运；汇编侧偏移由asm-offsets.c生成、
+ * 自动跟随结构布局，此处仅需钉住C侧前缀
+ */
+_Static_assert(offsetof(struct arch_context, regs) == offsetof(struct user_regs_struct, regs),
+               "regset prefix mismatch: regs");
+_Static_assert(offsetof(struct arch_context, csr_era) == offsetof(struct user_regs_struct, csr_era),
+               "regset prefix mismatch: csr_era");
+_Static_assert(offsetof(struct arch_context, csr_estat) == offsetof(struct user_regs_struct, csr_estat),
+               "regset prefix mismatch: csr_estat");
 /*************************** 内部函数声明 ****************************/
 /**
  * @brief 拷贝数据到用户空间
@@ -55,8 +76,108 @@ static unsigned long copy_to_user(void *to, const void *from, unsigned long n);
  * @return 成功返回0，失败返回非0（拷贝未完成的字节数）
  */
 static unsigned long copy_from_user(void *to, const void *from, unsigned long n);
+
+/**
+ * @brief 从异常帧单次导出通用寄存器集
+ *
+ * @param pcb  进程控制块指针（调用方保证有效且非首次启动）
+ * @param ubuf 用户缓冲区
+ * @param len  用户缓冲区长度（超出regset大小时截断）
+ *
+ * @return 成功返回0，失败返回负错误码
+ */
+static int ptrace_regs_fetch(pcb_t pcb, void *ubuf, size_t len);
+
+/**
+ * @brief 校验后整组写回通用寄存器集到异常帧
+ *
+ * @param pcb  进程控制块指针（调用方保证有效）
+ * @param ubuf 用户数据（regset布局）
+ * @param len  用户数据长度（超出regset大小时截断）
+ *
+ * @return 成功返回0，失败返回负错误码
+ */
+static int ptrace_regs_store(pcb_t pcb, const void *ubuf, size_t len);
 /*************************** 函数实现 ****************************/
 
+/**
+ * @brief 从异常帧单次导出通用寄存器集
+ *
+ * @details 异常帧保存前缀与user_regs_struct布局一致（见上方
+ *          静态断言），直接从pcb->exception_context整组拷贝
+ *          到用户缓冲，不经过中间struct user的两次搬运
+ *
+ * @param pcb  进程控制块指针（调用方保证有效且非首次启动）
+ * @param ubuf 用户缓冲区
+ * @param len  用户缓冲区长度（超出regset大小时截断）
+ *
+ * @return 成功返回0，失败返回负错误码
+ */
+static int ptrace_regs_fetch(pcb_t pcb, void *ubuf, size_t len)
+{
+    if (len > sizeof(struct user_regs_struct))
+    {
+        len = sizeof(struct user_regs_struct);
+    }
+
+    return (int)copy_to_user(ubuf, &pcb->exception_context, len);
+}
+
+/**
+ * @brief 校验后整组写回通用寄存器集到异常帧
+ *
+ * @details 以当前异常帧为模板在栈上构造regset视图，短缓冲仅
+ *          更新前缀字段；用户数据一次拷入、特权级校验通过后
+ *          整组单次memcpy回异常帧前缀，无动态分配
+ *
+ * @param pcb  进程控制块指针（调用方保证有效）
+ * @param ubuf 用户数据（regset布局）
+ * @param len  用户数据长度（超出regset大小时截断）
+ *
+ * @return 成功返回0，失败返回负错误码
+ *
+ * @retval 0 成功
+ * @retval -EFAULT 用户空间拷贝失败
+ * @retval -EINVAL 寄存器值非法（非PLV3）
+ */
+static int ptrace_regs_store(pcb_t pcb, const void *ubuf, size_t len)
+{
+    struct user_regs_struct tmp;
+
+    if (len > sizeof(tmp))
+    {
+        len = sizeof(tmp);
+    }
+
+    if (pcb->ptrace_first_start)
+    {
+        /* 首次启动尚无有效异常帧：零模板，入口地址作PC */
+        memset(&tmp, 0, sizeof(tmp));
+        tmp.csr_era = pcb->entry;
+    }
+    else
+    {
+        /* 以当前异常帧为模板，短缓冲仅更新前缀字段 */
+        memcpy(&tmp, &pcb->exception_context, sizeof(tmp));
+    }
+
+    if (copy_from_user(&tmp, ubuf, len) != 0UL)
+    {
+        return -EFAULT;
+    }
+
+    /* 与valid_user_regs语义一致：仅允许用户模式（PLV3）写回 */
+    if ((tmp.csr_crmd & CRMD_PLV) != 0x3UL)
+    {
+        return -EINVAL;
+    }
+
+    /* 布局前缀一致，整组单次写回异常帧 */
+    memcpy(&pcb->exception_context, &tmp, sizeof(tmp));
+
+    return 0;
+}
+
 /**
  * @brief 获取用户寄存器
  *
@@ -199,6 +320,28 @@ int ptrace_getregset(pcb_t pcb, void *uregs, int nt_type)
         return -EFAULT;
     }
 
+    /* 常规路径零拷贝：异常帧保存前缀即导出regset布局，直接
+     * 从异常帧单次拷贝到用户缓冲；首次启动尚无异常帧，走下方
+     * struct user模板路径 */
+    if (!pcb->ptrace_first_start)
+    {
+        if (nt_type == 0)
+        {
+            return ptrace_regs_fetch(pcb, uregs, sizeof(struct user_regs_struct));
+        }
+        if (nt_type == NT_PRSTATUS)
+        {
+            uiov = (struct iovec *)uregs;
+
+            if (!user_access_check(uiov, sizeof(*uiov), UACCESS_R | UACCESS_W))
+            {
+                return -EFAULT;
+            }
+
+            return ptrace_regs_fetch(pcb, uiov->iov_base, uiov->iov_len);
+        }
+    }
+
     regs = get_user_regs(pcb);
     if (regs == NULL)
     {
@@ -271,88 +414,54 @@ int ptrace_setregset(pcb_t pcb, void *uregs, int nt_type)
         return -EFAULT;
     }
 
-    /* 获取当前寄存器作为模板 */
-    newregs = get_user_regs(pcb);
-    if (newregs == NULL)
+    if (nt_type == 0)
+    {
+        /* 旧式接口：栈上视图一次拷入校验，整组写回异常帧 */
+        return ptrace_regs_store(pcb, uregs, sizeof(struct user_regs_struct));
+    }
+
+    /* 新式接口：使用 iovec */
+    uiov = (struct iovec *)uregs;
+
+    /* 检查用户空间指针 */
+    if (!user_access_check(uiov, sizeof(*uiov), UACCESS_R))
     {
         return -EFAULT;
     }
 
-    if (nt_type == 0)
+    switch (nt_type)
     {
-        /* 旧式接口：直接接收 user_regs_struct */
-        if (copy_from_user(&newregs->user_regs, uregs, sizeof(newregs->user_regs)) != 0)
-        {
-            ret = -EFAULT;
-        }
-        else
+    case NT_PRSTATUS:
+        /* 通用寄存器：单次拷入，整组写回异常帧前缀 */
+        ret = ptrace_regs_store(pcb, uiov->iov_base, uiov->iov_len);
+        break;
+
+    case NT_FPREGSET:
+        /* 浮点regset不在异常帧内，仍走struct user模板路径 */
+        newregs = get_user_regs(pcb);
+        if (newregs == NULL)
         {
-            if (valid_user_regs(newregs) == 0)
-            {
-                set_user_regs(pcb, newregs);
-                ret = 0;
-            }
-            else
-            {
-                ret = -EINVAL;
-            }
+            return -EFAULT;
         }
-    }
-    else
-    {
-        /* 新式接口：使用 iovec */
-        uiov = (struct iovec *)uregs;
 
-        /* 检查用户空间指针 */
-        if (!user_access_check(uiov, sizeof(*uiov), UACCESS_R))
+        if (copy_from_user(&newregs->user_fpsimd, uiov->iov_base, uiov->iov_len) != 0)
         {
             ret = -EFAULT;
         }
         else
         {
-            switch (nt_type)
-            {
-            case NT_PRSTATUS:
-                /* 通用寄存器 */
-                if (copy_from_user(&newregs->user_regs, uiov->iov_base, uiov->iov_len) != 0)
-                {
-                    ret = -EFAULT;
-                }
-                else
-                {
-                    if (valid_user_regs(newregs) == 0)
-                    {
-                        set_user_regs(pcb, newregs);
-                        ret = 0;
-                    }
-                    else
-                    {
-                        ret = -EINVAL;
-                    }
-                }
-                break;
-
-            case NT_FPREGSET:
-                /* 浮点寄存器 */
-                if (copy_from_user(&newregs->user_fpsimd, uiov->iov_base, uiov->iov_len) != 0)
-                {
-                    ret = -EFAULT;
-                }
-                else
-                {
-                    set_user_regs(pcb, newregs);
-                    ret = 0;
-                }
-                break;
-
-            default:
-                ret = -ENOSYS;
-                break;
-            }
+            set_user_regs(pcb, newregs);
+            ret = 0;
         }
+
+        free(newregs);
+        break;
+
+    default:
+        ret = -ENOSYS;
+        break;
     }
 
-    free(newregs);
     return ret;
 }
 
@@ -365,7 +474,7 @@ int ptrace_setregset(pcb_t pcb, void *uregs, int nt_type)
  *
  * @return 无
  *
- * @note 启用单步执行模式
+ * @note 启用硬件单步：全掩码取指断点，不改写指令流、不刷I-cache
  */
 void ptrace_set_bpt(pcb_t pcb)
 {
@@ -378,7 +487,8 @@ void ptrace_set_bpt(pcb_t pcb)
     /* 使用 CRMD 的 DAIE 位进行单步调试 */
     pcb->exception_context.csr_crmd |= CRMD_DAIE;
 
-    /* TODO: 设置硬件断点寄存器（如果需要） */
+    /* 在保留的取指断点组记录硬件单步，恢复进程时生效 */
+    hw_single_step_enable(pcb);
 }
 
 /**
@@ -402,7 +512,8 @@ void ptrace_cancel_bpt(pcb_t pcb)
     /* 清除单步调试标志 */
     pcb->exception_context.csr_crmd &= ~CRMD_DAIE;
 
-    /* TODO: 清除硬件断点寄存器（如果需要） */
+    /* 关闭硬件单步使用的取指断点组 */
+    hw_single_step_disable(pcb);
 }
 
 /**
@@ -418,25 +529,8 @@ void ptrace_cancel_bpt(pcb_t pcb)
  */
 void reset_debug_state(void)
 {
-    /* TODO: 清除所有硬件断点和观察点 */
-    /* LoongArch64 调试 CSR 寄存器：
-     * - PRCTL (0x80): 调试控制寄存器
-     * - PRB[0-15] (0xA0-0xAF): 断点地址寄存器
-     * - PRM[0-15] (0xB0-0xBF): 断点掩码寄存器
-     * - PRB_CTRL[0-15] (0xC0-0xCF): 断点控制寄存器
-     */
-
-    /* 清除 PRCTL 寄存器 */
-    // write_csr(0x80, 0);
-
-    /* 清除断点寄存器 */
-    /* for (int i = 0; i < 16; i++) */
-    /* { */
-    /*     write_csr(0xA0 + i, 0);     /\* PRB[i] *\/ */
-    /*     write_csr(0xC0 + i, 0);     /\* PRB_CTRL[i] *\/ */
-    /* } */
-
-    barrier();
+    /* 关闭本核全部IBn/DBn调试寄存器组并清除命中状态 */
+    hw_debug_clear_all();
 }
 
 /**
@@ -452,31 +546,13 @@ void reset_debug_state(void)
  */
 void restore_hw_debug(pcb_t pcb)
 {
-    int i;
-
     if (pcb == NULL)
     {
         return;
     }
 
-    /* TODO: 从 PCB 恢复硬件断点和观察点 */
-    /* 恢复断点设置 */
-    for (i = 0; i < pcb->debug_state.bp_count; i++)
-    {
-        /* 恢复断点寄存器（伪代码，需要实际 CSR 定义） */
-        /* write_dbg_bpr(i, pcb->debug_state.bp.dbg_regs[i].ctrl); */
-        /* write_dbg_bvr(i, pcb->debug_state.bp.dbg_regs[i].addr); */
-    }
-
-    /* 恢复观察点设置 */
-    for (i = 0; i < pcb->debug_state.wr_count; i++)
-    {
-        /* 恢复观察点寄存器 */
-        /* write_dbg_wpr(i, pcb->debug_state.wr.dbg_regs[i].ctrl); */
-        /* write_dbg_wvr(i, pcb->debug_state.wr.dbg_regs[i].addr); */
-    }
-
-    barrier();
+    /* 按PCB调试状态逐组写入硬件，未使用的组显式关闭 */
+    hw_debug_restore(pcb);
 }
 
 /*************************** 内部函数实现 ****************************/
@@ -485,7 +561,7 @@ void restore_hw_debug(pcb_t pcb)
  * @brief 拷贝数据到用户空间
  *
  * @details 将数据从内核空间拷贝到用户空间
- *          先检查用户空间地址有效性，再执行拷贝
+ *          单遍拷贝，访问出错由异常修复表处理
  *
  * @param to 目标地址（用户空间）
  * @param from 源地址（内核空间）
@@ -495,23 +571,14 @@ void restore_hw_debug(pcb_t pcb)
  */
 static unsigned long copy_to_user(void *to, const void *from, unsigned long n)
 {
-    /* 检查用户空间地址有效性 */
-    if (!user_access_check(to, n, UACCESS_W))
-    {
-        return n;
-    }
-
-    /* 执行拷贝 */
-    memcpy(to, from, n);
-
-    return 0;
+    return arch_copy_to_user(to, from, n);
 }
 
 /**
  * @brief 从用户空间拷贝数据
  *
  * @details 将数据从用户空间拷贝到内核空间
- *          先检查用户空间地址有效性，再执行拷贝
+ *          单遍拷贝，访问出错由异常修复表处理
  *
  * @param to 目标地址（内核空间）
  * @param from 源地址（用户空间）
@@ -521,16 +588,7 @@ static unsigned long copy_to_user(void *to, const void *from, unsigned long n)
  */
 static unsigned long copy_from_user(void *to, const void *from, unsigned long n)
 {
-    /* 检查用户空间地址有效性 */
-    if (!user_access_check(from, n, UACCESS_R))
-    {
-        return n;
-    }
-
-    /* 执行拷贝 */
-    memcpy(to, from, n);
-
-    return 0;
+    return arch_copy_from_user(to, from, n);
 }
 
 /*************************** 进程查找辅助函数 ****************************/
@@ -538,54 +596,29 @@ static unsigned long copy_from_user(void *to, const void *from, unsigned long n)
 /**
  * @brief 根据 PID 查找进程控制块
  *
- * @details 从进程表中查找指定 PID 的 PCB
+ * @details 经pid→pcb哈希索引查找，读侧无锁，O(1)复杂度；
+ *          索引由进程创建/退出路径维护（pid_hash_insert/remove）
  *
  * @param pid 进程 ID
  *
  * @return 成功返回 PCB 指针，失败返回 NULL
- *
- * @note TODO: 需要连接到实际的任务管理系统
  */
 static pcb_t find_pcb_by_pid(pid_t pid)
 {
-    /* TODO: 实际实现需要从任务管理系统中查找 */
-    /*
-     * 参考实现伪代码：
-     *
-     * if (pid == 0) {
-     *     return current_pcb;  // 当前进程
-     * }
-     *
-     * struct task_struct *task = find_task_by_vpid(pid);
-     * if (task == NULL) {
-     *     return NULL;
-     * }
-     *
-     * return task->pcb;
-     */
-
-    (void)pid;
-    return NULL; /* 临时返回 NULL，实际使用时需要实现 */
+    return pid_hash_lookup(pid);
 }
 
 /**
  * @brief 获取当前进程的 PCB
  *
- * @return 返回当前进程的 PCB 指针
+ * @details per-CPU当前进程指针直取，无查找开销；
+ *          指针由上下文切换路径维护（pid_current_set）
  *
- * @note TODO: 需要连接到实际的任务管理系统
+ * @return 返回当前进程的 PCB 指针
  */
 static pcb_t get_current_pcb(void)
 {
-    /* TODO: 实际实现需要从任务管理系统中获取当前进程 */
-    /*
-     * 参考实现伪代码：
-     *
-     * TASK_ID tid = ttosGetRunningTask();
-     * return get_pcb_by_task_id(tid);
-     */
-
-    return NULL; /* 临时返回 NULL，实际使用时需要实现 */
+    return pid_current_get();
 }
 
 /*************************** 内存访问辅助函数 ****************************/
@@ -604,37 +637,39 @@ static pcb_t get_current_pcb(void)
  */
 static int ptrace_read_mem(pcb_t pcb, void *addr, void *data, size_t size)
 {
+    uintptr_t src;
+    char *dst;
+    size_t chunk;
+    size_t remain;
+
     if ((pcb == NULL) || (addr == NULL) || (data == NULL))
     {
         return -EINVAL;
     }
 
-    /* TODO: 实现跨进程内存读取 */
-    /*
-     * 参考实现伪代码：
-     *
-     * 1. 检查目标地址是否在用户空间
-     * 2. 切换到目标进程的地址空间
-     * 3. 执行内存读取
-     * 4. 恢复当前进程的地址空间
-     *
-     * if (!access_ok(VERIFY_READ, addr, size)) {
-     *     return -EFAULT;
-     * }
-     *
-     * old_mm = current->mm;
-     * current->mm = pcb->mm;
-     * barrier();
-     *
-     * ret = copy_from_user_kernel(data, addr, size);
-     *
-     * current->mm = old_mm;
-     * barrier();
-     */
-
-    (void)pcb;
-    (void)size;
-    return -ENOSYS; /* 暂不支持 */
+    /* 按页跨界分段拷贝：每段不越过页边界，校验与缺页处理以页为粒度；
+     * 目标进程已被跟踪停止，地址空间平坦映射可直接访问。
+     * TODO: 独立地址空间进程需在此切换/恢复目标页表 */
+    src = (uintptr_t)addr;
+    dst = (char *)data;
+    remain = size;
+    while (remain > 0U)
+    {
+        chunk = PTRACE_PAGE_SIZE - (src & (PTRACE_PAGE_SIZE - 1U));
+        if (chunk > remain)
+        {
+            chunk = remain;
+        }
+        if (copy_from_user(dst, (const void *)src, chunk) != 0UL)
+        {
+            return -EFAULT;
+        }
+        src += chunk;
+        dst += chunk;
+        remain -= chunk;
+    }
+
+    return 0;
 }
 
 /**
@@ -651,19 +686,88 @@ static int ptrace_read_mem(pcb_t pcb, void *addr, void *data, size_t size)
  */
 static int ptrace_write_mem(pcb_t pcb, void *addr, const void *data, size_t size)
 {
+    uintptr_t dst;
+    const char *src;
+    size_t chunk;
+    size_t remain;
+
     if ((pcb == NULL) || (addr == NULL) || (data == NULL))
     {
         return -EINVAL;
     }
 
-    /* TODO: 实现跨进程内存写入 */
-    /* 参考实现同 ptrace_read_mem */
+    /* 按页跨界分段拷贝，处理方式同 ptrace_read_mem */
+    dst = (uintptr_t)addr;
+    src = (const char *)data;
+    remain = size;
+    while (remain > 0U)
+    {
+        chunk = PTRACE_PAGE_SIZE - (dst & (PTRACE_PAGE_SIZE - 1U));
+        if (chunk > remain)
+        {
+            chunk = remain;
+        }
+        if (copy_to_user((void *)dst, src, chunk) != 0UL)
+        {
+            return -EFAULT;
+        }
+        dst += chunk;
+        src += chunk;
+        remain -= chunk;
+    }
 
-    (void)pcb;
-    (void)addr;
-    (void)data;
-    (void)size;
-    return -ENOSYS; /* 暂不支持 */
+    return 0;
+}
+
+/**
+ * @brief 批量内存传输（PTRACE_READ_MEMV/PTRACE_WRITE_MEMV）
+ *
+ * @details 按 iovec 风格的分段描述数组逐段搬运目标进程内存，
+ *          单次系统调用完成任意大小的数据传输，
+ *          替代 PEEKDATA/POKEDATA 的逐字往返
+ *
+ * @param pcb 目标进程 PCB
+ * @param vec 分段描述数组
+ * @param cnt 分段个数（不超过 PTRACE_MEMV_MAX）
+ * @param is_write 非0表示写入目标进程，0表示读取
+ *
+ * @return 成功返回搬运的总字节数；某段出错时，若已有数据搬运完成
+ *         则返回已完成的字节数，否则返回负错误码
+ */
+static long ptrace_memv_transfer(pcb_t pcb, struct ptrace_memv *vec, size_t cnt, int is_write)
+{
+    size_t i;
+    long total = 0;
+    int err;
+
+    if ((vec == NULL) || (cnt == 0U) || (cnt > PTRACE_MEMV_MAX))
+    {
+        return -EINVAL;
+    }
+
+    for (i = 0U; i < cnt; i++)
+    {
+        if (vec[i].pm_len == 0U)
+        {
+            continue;
+        }
+        if (is_write != 0)
+        {
+            err = ptrace_write_mem(pcb, vec[i].pm_remote, vec[i].pm_local, vec[i].pm_len);
+        }
+        else
+        {
+            err = ptrace_read_mem(pcb, vec[i].pm_remote, vec[i].pm_local, vec[i].pm_len);
+        }
+        if (err != 0)
+        {
+            /* 部分完成语义：已搬运的数据有效，由调用方比对返回值 */
+            return (total > 0) ? total : (long)err;
+        }
+        total += (long)vec[i].pm_len;
+    }
+
+    return total;
 }
 
 /*************************** PEEKUSER/POKEUSER 辅助函数 ****************************/
@@ -956,6 +1060,26 @@ long sys_ptrace(enum __ptrace_request request, pid_t pid, void *addr, void *data
         ret = (long)ptrace_write_mem(target_pcb, addr, &peek_data, sizeof(unsigned long));
         break;
 
+    case PTRACE_READ_MEMV:
+    case PTRACE_WRITE_MEMV:
+        /* 批量内存传输（扩展请求） */
+        /* addr 是 ptrace_memv 数组指针，data 是数组元素个数 */
+        if (addr == NULL)
+        {
+            ret = -EFAULT;
+            break;
+        }
+
+        if (target_pcb == NULL)
+        {
+            ret = -ESRCH;
+            break;
+        }
+
+        ret = ptrace_memv_transfer(target_pcb, (struct ptrace_memv *)addr, (size_t)(uintptr_t)data,
+                                   (request == PTRACE_WRITE_MEMV) ? 1 : 0);
+        break;
+
     case PTRACE_POKEUSER:
         /* 向 USER 区域写入（寄存器） */
         /* addr 是寄存器偏移，data 是要写入的数据 */
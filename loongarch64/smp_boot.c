@@ -0,0 +1,116 @@
+/**
+ * @file    smp_boot.c
+ * @brief   从核并行启动汇合实现
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件实现从核并行启动的汇合设施
+ *          - 就绪计数原子递增，主核idle自旋等待到达预期值，
+ *            从核侧汇合开销为一次原子加
+ *          - 全局串行段复用ticket锁，保证按到达顺序公平通过
+ *          - 逐核串行拉起改为并行后，各核本地初始化相互重叠，
+ *            总启动耗时由各核之和降为最慢核耗时加串行段
+ *
+ * @note MISRA-C:2012 合规
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+#define KLOG_TAG "smpboot"
+
+/*************************** 头文件包含 ****************************/
+#include <atomic.h>
+#include <barrier.h>
+#include <cpu.h>
+#include <errno.h>
+#include <klog.h>
+#include <smp-boot.h>
+#include <ticket-lock.h>
+#include <ttos_time.h>
+
+/*************************** 宏定义 ****************************/
+
+
+/*************************** 数据结构 ****************************/
+
+
+/*************************** 模块变量 ****************************/
+/* 预期汇合的从核数 */
+static volatile u32 s_expected = 0U;
+
+/* 已就绪从核计数（各从核原子递增） */
+static volatile int s_arrived = 0;
+
+/* 启动期全局串行段锁 */
+static DEFINE_TICKET_LOCK(s_serial_lock);
+
+/*************************** 函数实现 ****************************/
+
+/**
+ * @brief 武装从核启动汇合
+ *
+ * @param secondary_count 预期拉起的从核数
+ */
+void smp_boot_begin(u32 secondary_count)
+{
+    s_arrived = 0;
+    s_expected = secondary_count;
+    smp_wmb();
+}
+
+/**
+ * @brief 从核就绪汇合点
+ *
+ * @details 原子递增就绪计数；递增前加存储屏障，保证本核
+ *          初始化阶段的写入先于就绪标志对主核可见
+ */
+void smp_boot_arrive(void)
+{
+    smp_wmb();
+    (void)atomic32_add((volatile int *)&s_arrived, 1);
+}
+
+/**
+ * @brief 主核等待全部从核汇合
+ *
+ * @param timeout_ms 等待超时（毫秒）
+ *
+ * @return 全部就绪返回0，超时返回-ETIMEDOUT
+ */
+s32 smp_boot_wait_all(u32 timeout_ms)
+{
+    u64 deadline = drdtime() + ((ttos_time_freq_get() * (u64)timeout_ms) / 1000U);
+
+    while ((u32)s_arrived < s_expected)
+    {
+        if (drdtime() >= deadline)
+        {
+            KLOG_E("secondary rendezvous timeout: %d/%u ready",
+                   s_arrived, s_expected);
+
+            return -ETIMEDOUT;
+        }
+        __asm__ volatile("idle 0");
+    }
+
+    smp_rmb();
+
+    return 0;
+}
+
+/**
+ * @brief 进入启动期全局串行段
+ */
+void smp_boot_serial_begin(void)
+{
+    ticket_lock_acquire(&s_serial_lock);
+}
+
+/**
+ * @brief 离开启动期全局串行段
+ */
+void smp_boot_serial_end(void)
+{
+    ticket_lock_release(&s_serial_lock);
+}
@@ -0,0 +1,111 @@
+/**
+ * @file    syscall_fast.c
+ * @brief   LoongArch64快速系统调用分发实现
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件实现快速系统调用的标志管理和C层分发
+ *          - syscall_fast_flag按调用号标记是否允许走轻量入口，
+ *            由entry.S在构建完整上下文帧之前查询分流
+ *          - do_fast_syscall在轻量帧上直接分发到基础系统调用表，
+ *            不保存异常上下文、不做信号与调度检查
+ *          - 默认全部走慢路径，快速调用需显式注册
+ *
+ * @note MISRA-C:2012 合规
+ * @note 轻量路径全程关中断执行，注册的调用必须足够短
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+/*************************** 头文件包含 ****************************/
+#include <errno.h>
+#include <stddef.h>
+#include <syscall-fast.h>
+#include <syscalls.h>
+
+/*************************** 宏定义 ****************************/
+
+/*************************** 类型定义 ****************************/
+
+/*************************** 外部声明 ****************************/
+extern syscall_func syscall_table[CONFIG_SYSCALL_NUM];
+
+/*************************** 前向声明 ****************************/
+
+/*************************** 模块变量 ****************************/
+
+/*************************** 全局变量 ****************************/
+/* 快速系统调用标志：非零表示该调用号走轻量入口（entry.S查询） */
+unsigned char syscall_fast_flag[CONFIG_SYSCALL_NUM];
+
+/*************************** 函数实现 ****************************/
+
+/**
+ * @brief 快速系统调用C层分发
+ *
+ * @details 由entry.S轻量入口调用：调用号已在汇编层完成越界和
+ *          标志检查，此处直接分发到基础系统调用表
+ *
+ * @param arg0 系统调用参数1
+ * @param arg1 系统调用参数2
+ * @param arg2 系统调用参数3
+ * @param arg3 系统调用参数4
+ * @param arg4 系统调用参数5
+ * @param arg5 系统调用参数6
+ * @param num 系统调用号
+ *
+ * @return 系统调用返回值
+ *
+ * @note 性能关键路径：汇编入口保证调用号有效且处理函数非空
+ */
+long do_fast_syscall(long arg0, long arg1, long arg2, long arg3, long arg4, long arg5, long num)
+{
+    return syscall_table[num](arg0, arg1, arg2, arg3, arg4, arg5);
+}
+
+/**
+ * @brief 注册快速系统调用
+ *
+ * @details 检查调用号有效且处理函数已安装后置位标志
+ *
+ * @param num 系统调用号（基础表范围内）
+ *
+ * @return 成功返回0，失败返回-EINVAL
+ */
+int syscall_fast_register(int num)
+{
+    if ((num < 0) || (num >= CONFIG_SYSCALL_NUM))
+    {
+        return -EINVAL;
+    }
+    if (syscall_table[num] == NULL)
+    {
+        return -EINVAL;
+    }
+
+    syscall_fast_flag[num] = 1U;
+
+    return 0;
+}
+
+/**
+ * @brief 注销快速系统调用
+ *
+ * @details 清除标志使该调用号恢复完整帧慢路径
+ *
+ * @param num 系统调用号（基础表范围内）
+ *
+ * @return 成功返回0，失败返回-EINVAL
+ */
+int syscall_fast_unregister(int num)
+{
+    if ((num < 0) || (num >= CONFIG_SYSCALL_NUM))
+    {
+        return -EINVAL;
+    }
+
+    syscall_fast_flag[num] = 0U;
+
+    return 0;
+}
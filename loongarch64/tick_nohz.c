@@ -0,0 +1,130 @@
+/**
+ * @file    tick_nohz.c
+ * @brief   无滴答空闲模式（NO_HZ）实现
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件实现tickless空闲模式
+ *          - 核进入idle时把本核定时器切换到单次模式，按下一个
+ *            最近到期事件编程触发时刻，空闲期间不再产生周期tick
+ *          - 任意中断（定时器到期或设备中断）唤醒后，退出路径按
+ *            计数器实际流逝量折算错过的tick数，由idle循环补偿
+ *            jiffies后恢复周期模式
+ *          - 全部状态为per-CPU私有，进入/退出路径无锁
+ *
+ * @note MISRA-C:2012 合规
+ * @note 进入/退出接口须在关中断的idle路径中成对调用
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+/*************************** 头文件包含 ****************************/
+#include <cpu.h>
+#include <cpuid.h>
+#include <errno.h>
+#include <tick-nohz.h>
+#include <time/ktime.h>
+#include <ttos_time.h>
+
+/*************************** 宏定义 ****************************/
+/* 无未决事件时的最大单次睡眠时长（纳秒），醒来校准一次 */
+#define TICK_NOHZ_MAX_SLEEP_NS ((u64)NSEC_PER_SEC)
+
+/*************************** 数据结构 ****************************/
+/**
+ * @brief per-CPU tickless状态
+ *
+ * @details 仅由本核在idle路径读写，缓存行对齐避免伪共享
+ */
+struct tick_nohz_state
+{
+    volatile int active;   /**< @brief 本核是否处于tickless状态 */
+    u64 enter_count;       /**< @brief 进入时的计数器值 */
+} __attribute__((aligned(64)));
+
+/*************************** 外部声明 ****************************/
+extern int constant_set_state_oneshot(void);
+extern int constant_set_state_periodic(void);
+
+/*************************** 模块变量 ****************************/
+/* per-CPU tickless状态 */
+static struct tick_nohz_state s_nohz_state[CONFIG_MAX_CPUS];
+
+/*************************** 函数实现 ****************************/
+
+/**
+ * @brief 进入无滴答空闲
+ *
+ * @details 记录进入时刻的计数器值，切换本核定时器到单次模式并
+ *          按下一个最近到期事件编程触发时刻；事件早于一个tick
+ *          周期时继续按周期tick运行，不值得切换模式
+ *
+ * @param next_event_ns 下一个最近到期事件的相对时间（纳秒）；
+ *                      为0表示无未决事件，按最大睡眠时长编程
+ *
+ * @return 成功进入tickless返回0，到期过近未进入返回-EAGAIN
+ *
+ * @note 性能关键路径：只操作本核数据，调用方保证关中断
+ */
+s32 tick_nohz_idle_enter(u64 next_event_ns)
+{
+    struct tick_nohz_state *state = &s_nohz_state[cpuid_get()];
+    u64 tick_ns = (u64)NSEC_PER_SEC / (u64)HZ;
+
+    if (next_event_ns == 0U)
+    {
+        next_event_ns = TICK_NOHZ_MAX_SLEEP_NS;
+    }
+
+    /* 到期早于一个tick周期时切换模式得不偿失，保持周期tick */
+    if (next_event_ns <= tick_ns)
+    {
+        return -EAGAIN;
+    }
+
+    state->enter_count = ttos_time_count_get();
+    state->active = 1;
+
+    constant_set_state_oneshot();
+    ttos_time_timeout_set(next_event_ns);
+
+    return 0;
+}
+
+/**
+ * @brief 退出无滴答空闲
+ *
+ * @details 按计数器实际流逝量折算空闲期间错过的tick数并恢复
+ *          周期模式；被设备中断提前唤醒时流逝量小于编程时长，
+ *          折算结果同样正确
+ *
+ * @return 需要补偿的tick数；未处于tickless状态返回0
+ *
+ * @note 性能关键路径：只操作本核数据，调用方保证关中断
+ */
+u32 tick_nohz_idle_exit(void)
+{
+    struct tick_nohz_state *state = &s_nohz_state[cpuid_get()];
+    u64 elapsed;
+    u64 freq;
+
+    if (state->active == 0)
+    {
+        return 0U;
+    }
+    state->active = 0;
+
+    elapsed = ttos_time_count_get() - state->enter_count;
+    freq = (u64)ttos_time_freq_get();
+
+    /* 恢复周期tick：constant_set_state_periodic重新装载周期初值 */
+    constant_set_state_periodic();
+
+    if (freq == 0U)
+    {
+        return 0U;
+    }
+
+    return (u32)((elapsed * (u64)HZ) / freq);
+}
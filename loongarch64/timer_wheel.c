@@ -0,0 +1,341 @@
+/**
+ * @file    timer_wheel.c
+ * @brief   per-CPU层级定时器轮实现
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件实现三级per-CPU时间轮
+ *          - 每级64槽：级0粒度1tick覆盖64tick，级1粒度64tick，
+ *            级2粒度4096tick，合计覆盖262144个tick
+ *          - 定时器按到期距离挂入对应级别，级0索引回绕时把
+ *            高层槽级联下放，摊还开销O(1)
+ *          - 每tick把本槽到期链表整体摘下后在锁外批量执行回调，
+ *            同一tick到期的数万超时只消耗一次中断
+ *          - 每核轮独立加锁（支持跨核取消），桶数组缓存行对齐
+ *            避免相邻核伪共享
+ *
+ * @note MISRA-C:2012 合规
+ * @note 回调在定时器所在核的中断上下文执行，不得睡眠
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+/*************************** 头文件包含 ****************************/
+#include <cpu.h>
+#include <cpuid.h>
+#include <errno.h>
+#include <spinlock.h>
+#include <stddef.h>
+#include <timer-wheel.h>
+
+/*************************** 宏定义 ****************************/
+/* 槽索引掩码 */
+#define TWHEEL_SLOT_MASK (TWHEEL_SLOTS - 1U)
+
+/* 各级覆盖范围（tick） */
+#define TWHEEL_LVL_RANGE(lvl) (1ULL << (TWHEEL_SLOT_BITS * ((lvl) + 1U)))
+
+/*************************** 数据结构 ****************************/
+/**
+ * @brief per-CPU时间轮
+ *
+ * @details 桶数组缓存行对齐；cur_tick单调递增，
+ *          槽索引为cur_tick在对应级别的位段
+ */
+struct twheel
+{
+    struct twheel_timer *slot[TWHEEL_LEVELS][TWHEEL_SLOTS]; /**< @brief 槽链表头 */
+    u64 cur_tick;                                           /**< @brief 本核当前tick */
+    spinlock_t lock;                                        /**< @brief 轮锁（支持跨核取消） */
+} __attribute__((aligned(64)));
+
+/*************************** 模块变量 ****************************/
+/* per-CPU时间轮 */
+static struct twheel s_twheel[CONFIG_MAX_CPUS];
+
+/*************************** 内部函数声明 ****************************/
+static void twheel_enqueue(struct twheel *wheel, struct twheel_timer *timer);
+static void twheel_dequeue(struct twheel_timer *timer);
+
+/*************************** 函数实现 ****************************/
+
+/**
+ * @brief 把定时器挂入对应级别的槽
+ *
+ * @details 按到期距离选级：距离越远挂越高层；
+ *          已到期（距离为0）的挂入级0当前槽的下一槽
+ *
+ * @note 调用方持有轮锁
+ */
+static void twheel_enqueue(struct twheel *wheel, struct twheel_timer *timer)
+{
+    struct twheel_timer **head;
+    u64 delta;
+    u32 lvl;
+    u32 idx;
+
+    delta = timer->expires - wheel->cur_tick;
+
+    for (lvl = 0U; lvl < (TWHEEL_LEVELS - 1U); lvl++)
+    {
+        if (delta < TWHEEL_LVL_RANGE(lvl))
+        {
+            break;
+        }
+    }
+
+    /* 超出总覆盖范围的挂最高层最远槽，级联时再下放 */
+    if (delta >= TWHEEL_LVL_RANGE(TWHEEL_LEVELS - 1U))
+    {
+        timer->expires = wheel->cur_tick + TWHEEL_LVL_RANGE(TWHEEL_LEVELS - 1U) - 1U;
+    }
+
+    idx = (u32)((timer->expires >> (TWHEEL_SLOT_BITS * lvl)) & TWHEEL_SLOT_MASK);
+
+    head = &wheel->slot[lvl][idx];
+    timer->next = *head;
+    timer->pprev = head;
+    if (*head != NULL)
+    {
+        (*head)->pprev = &timer->next;
+    }
+    *head = timer;
+    timer->pending = 1;
+}
+
+/**
+ * @brief 把定时器从槽链表摘下
+ *
+ * @note 调用方持有轮锁，定时器必须在队列中
+ */
+static void twheel_dequeue(struct twheel_timer *timer)
+{
+    *timer->pprev = timer->next;
+    if (timer->next != NULL)
+    {
+        timer->next->pprev = timer->pprev;
+    }
+    timer->next = NULL;
+    timer->pprev = NULL;
+    timer->pending = 0;
+}
+
+/**
+ * @brief 初始化定时器对象
+ *
+ * @param timer 定时器对象（调用方提供存储）
+ * @param func  到期回调
+ * @param arg   回调参数
+ *
+ * @return 成功返回0，参数无效返回-EINVAL
+ */
+s32 twheel_timer_init(struct twheel_timer *timer, twheel_fn func, void *arg)
+{
+    if ((timer == NULL) || (func == NULL))
+    {
+        return -EINVAL;
+    }
+
+    timer->next = NULL;
+    timer->pprev = NULL;
+    timer->expires = 0U;
+    timer->func = func;
+    timer->arg = arg;
+    timer->cpu = 0U;
+    timer->pending = 0;
+
+    return 0;
+}
+
+/**
+ * @brief 把定时器加入本核时间轮
+ *
+ * @param timer       定时器对象
+ * @param delta_ticks 相对当前的到期tick数（0按1处理）
+ *
+ * @return 成功返回0，参数无效返回-EINVAL
+ */
+s32 twheel_add(struct twheel_timer *timer, u64 delta_ticks)
+{
+    struct twheel *wheel;
+    long flags;
+    u32 cpu;
+
+    if ((timer == NULL) || (timer->func == NULL))
+    {
+        return -EINVAL;
+    }
+
+    if (delta_ticks == 0U)
+    {
+        delta_ticks = 1U;
+    }
+
+    /* 已入队的先取消，再按新到期时刻重新入队 */
+    if (timer->pending != 0)
+    {
+        (void)twheel_cancel(timer);
+    }
+
+    cpu = cpuid_get();
+    wheel = &s_twheel[cpu];
+
+    spin_lock_irqsave(&wheel->lock, flags);
+    timer->cpu = cpu;
+    timer->expires = wheel->cur_tick + delta_ticks;
+    twheel_enqueue(wheel, timer);
+    spin_unlock_irqrestore(&wheel->lock, flags);
+
+    return 0;
+}
+
+/**
+ * @brief 取消定时器
+ *
+ * @param timer 定时器对象
+ *
+ * @return 取消成功返回true，定时器不在队列中返回false
+ */
+bool twheel_cancel(struct twheel_timer *timer)
+{
+    struct twheel *wheel;
+    long flags;
+    bool removed = false;
+
+    if (timer == NULL)
+    {
+        return false;
+    }
+
+    wheel = &s_twheel[timer->cpu];
+
+    spin_lock_irqsave(&wheel->lock, flags);
+    /* pending须在锁内复查：可能已被tick路径摘下触发 */
+    if (timer->pending != 0)
+    {
+        twheel_dequeue(timer);
+        removed = true;
+    }
+    spin_unlock_irqrestore(&wheel->lock, flags);
+
+    return removed;
+}
+
+/**
+ * @brief 本核时间轮推进一个tick
+ *
+ * @details 级0索引回绕到0时逐级把高层槽级联下放；本tick到期槽
+ *          的链表整体摘下，回调在锁外批量执行，锁持有时间有界
+ */
+void twheel_tick(void)
+{
+    struct twheel *wheel = &s_twheel[cpuid_get()];
+    struct twheel_timer *expired;
+    struct twheel_timer *timer;
+    long flags;
+    u32 lvl;
+    u32 idx;
+
+    spin_lock_irqsave(&wheel->lock, flags);
+
+    wheel->cur_tick++;
+
+    /* 级联：本级索引回绕到0时把上一层当前槽下放重新入队 */
+    for (lvl = 1U; lvl < TWHEEL_LEVELS; lvl++)
+    {
+        if (((wheel->cur_tick >> (TWHEEL_SLOT_BITS * (lvl - 1U))) & TWHEEL_SLOT_MASK) != 0U)
+        {
+            break;
+        }
+
+        idx = (u32)((wheel->cur_tick >> (TWHEEL_SLOT_BITS * lvl)) & TWHEEL_SLOT_MASK);
+        timer = wheel->slot[lvl][idx];
+        wheel->slot[lvl][idx] = NULL;
+
+        while (timer != NULL)
+        {
+            struct twheel_timer *next = timer->next;
+
+            twheel_enqueue(wheel, timer);
+            timer = next;
+        }
+    }
+
+    /* 整体摘下本tick到期槽，标记为已出队 */
+    idx = (u32)(wheel->cur_tick & TWHEEL_SLOT_MASK);
+    expired = wheel->slot[0][idx];
+    wheel->slot[0][idx] = NULL;
+
+    timer = expired;
+    while (timer != NULL)
+    {
+        timer->pprev = NULL;
+        timer->pending = 0;
+        timer = timer->next;
+    }
+
+    spin_unlock_irqrestore(&wheel->lock, flags);
+
+    /* 锁外批量执行回调 */
+    while (expired != NULL)
+    {
+        struct twheel_timer *next = expired->next;
+
+        expired->next = NULL;
+        expired->func(expired->arg);
+        expired = next;
+    }
+}
+
+/**
+ * @brief 查询本核最近到期点
+ *
+ * @details 先扫级0的64个槽；级0为空时按高层粒度给出保守值，
+ *          供tickless idle编程单次硬件比较器
+ *
+ * @return 距最近到期的tick数；轮上无定时器返回0
+ */
+u64 twheel_next_event_ticks(void)
+{
+    struct twheel *wheel = &s_twheel[cpuid_get()];
+    long flags;
+    u64 ret = 0U;
+    u32 lvl;
+    u32 i;
+
+    spin_lock_irqsave(&wheel->lock, flags);
+
+    for (i = 1U; i <= TWHEEL_SLOT_MASK; i++)
+    {
+        if (wheel->slot[0][(wheel->cur_tick + i) & TWHEEL_SLOT_MASK] != NULL)
+        {
+            ret = i;
+            break;
+        }
+    }
+
+    /* 级0为空：高层有挂起时按该级最小粒度给保守到期点 */
+    if (ret == 0U)
+    {
+        for (lvl = 1U; lvl < TWHEEL_LEVELS; lvl++)
+        {
+            for (i = 0U; i < TWHEEL_SLOTS; i++)
+            {
+                if (wheel->slot[lvl][i] != NULL)
+                {
+                    ret = TWHEEL_LVL_RANGE(lvl - 1U);
+                    break;
+                }
+            }
+            if (ret != 0U)
+            {
+                break;
+            }
+        }
+    }
+
+    spin_unlock_irqrestore(&wheel->lock, flags);
+
+    return ret;
+}
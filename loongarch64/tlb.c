@@ -18,13 +18,18 @@
 
 /*************************** 头文件包含 ****************************/
 #include <adrspace.h>
+#include <asm-extable.h>
 #include <asm.h>
 #include <barrier.h>
+#include <cpu-features.h>
+#include <cpu-info.h>
 #include <cpu.h>
 #include <exception.h>
 #include <mmu.h>
+#include <spinlock.h>
 #include <tlb.h>
 #include <ttosBase.h>
+#include <ttosMM.h>
 
 /*************************** 宏定义 ****************************/
 
@@ -44,6 +49,17 @@ pgd_t kernel_pg_dir[PTRS_PER_PGD] __attribute__((__section__(".bss..kernel_pg_di
 pgd_t usr_pg_dir[PTRS_PER_PGD] __attribute__((__section__(".bss..page_aligned")))
                               __attribute__((__aligned__(PAGE_SIZE)));
 
+/* ASID分配器：代际计数编码在ASID高位，低位为硬件ASID */
+static DEFINE_SPINLOCK(asid_lock);
+static unsigned long asid_first_version;                 /* 代际步进值（asid_mask + 1） */
+static unsigned long asid_generation;                    /* 当前代际 */
+static unsigned long asid_next = 1;                      /* 本代际内下一个可分配的ASID（0保留给内核） */
+static unsigned long active_asid[CONFIG_MAX_CPUS];       /* 每核当前激活的版本化ASID */
+
+/* 每核TLB重填计数器：位于内核镜像直接映射区，重填处理中访问不经TLB；
+ * 缓存行隔离避免多核伪共享 */
+static u64 tlb_refill_count[CONFIG_MAX_CPUS][8] __attribute__((aligned(64)));
+
 /*************************** 全局变量 ****************************/
 
 /*************************** 函数实现 ****************************/
@@ -84,6 +100,57 @@ void local_flush_tlb_kernel(void)
     invtlb_all(INVTLB_CURRENT_GTRUE, 0, 0);
 }
 
+/**
+ * @brief 激活地址空间的ASID
+ *
+ * @details 检查mm持有的版本化ASID是否属于当前代际，过期则重新分配；
+ *          ASID耗尽时代际递增回绕重新从头分配。本核跨入新代际时
+ *          清一次本核用户空间TLB，防止旧代际同号表项残留，其余
+ *          切换路径不再需要全量TLB刷新
+ *
+ * @param[in] mm 将要切入的地址空间
+ *
+ * @return 返回应写入LOONGARCH_CSR_ASID的硬件ASID值
+ */
+unsigned long tlb_asid_activate(struct mm *mm)
+{
+    unsigned long asid_mask = cpu_asid_mask(&current_cpu_data);
+    unsigned long asid;
+    unsigned int cpu = cpuid_get();
+    irq_flags_t flags;
+
+    spin_lock_irqsave(&asid_lock, flags);
+    if (asid_first_version == 0)
+    {
+        /* 首次使用时按硬件ASID宽度初始化代际 */
+        asid_first_version = asid_mask + 1;
+        asid_generation = asid_first_version;
+    }
+    asid = mm->asid;
+    if (((asid ^ asid_generation) & ~asid_mask) != 0)
+    {
+        /* mm持有的ASID已过期，分配新值 */
+        if (asid_next > asid_mask)
+        {
+            /* 本代际耗尽，回绕进入新代际 */
+            asid_generation += asid_first_version;
+            asid_next = 1;
+        }
+        asid = asid_generation | asid_next;
+        asid_next++;
+        mm->asid = asid;
+    }
+    if (((active_asid[cpu] ^ asid) & ~asid_mask) != 0)
+    {
+        /* 本核跨代际：清除本核G=0表项，旧代际同号映射不可复用 */
+        local_flush_tlb_user();
+    }
+    active_asid[cpu] = asid;
+    spin_unlock_irqrestore(&asid_lock, flags);
+
+    return asid & asid_mask;
+}
+
 /**
  * @brief 设置页表遍历器
  *
@@ -118,6 +185,12 @@ static void setup_ptwalker(void)
     pwctl0 = pte_i | pte_w << 5 | pmd_i << 10 | pmd_w << 15 | pud_i << 20 | pud_w << 25;
     pwctl1 = pgd_i | pgd_w << 6;
 
+    /* 具备硬件页表遍历器时启用纯硬件重填，重填不再进入软件异常路径 */
+    if (cpu_has_ptw)
+    {
+        pwctl1 |= CSR_PWCTL1_PTW;
+    }
+
     csr_write64(pwctl0, LOONGARCH_CSR_PWCTL0);
     csr_write64(pwctl1, LOONGARCH_CSR_PWCTL1);
     csr_write64(PHYSADDR((long)kernel_pg_dir), LOONGARCH_CSR_PGDH);
@@ -138,10 +211,18 @@ static void setup_tlb_handler(void)
     setup_ptwalker();
     local_flush_tlb_all();
 
+    /* 预置本核重填计数器地址，供剖析版重填处理使用 */
+    csr_write64((unsigned long)&tlb_refill_count[get_csr_cpuid()][0], LOONGARCH_CSR_KS5);
+
     /* The tlb handlers are generated only once */
     if (get_csr_cpuid() == 0)
     {
+#ifdef CONFIG_TLB_REFILL_STAT
+        /* 剖析构建：安装带重填计数的版本，每次重填多6条指令 */
+        memcpy((void *)tlbrentry, handle_tlb_refill_stat, 0x80);
+#else
         memcpy((void *)tlbrentry, handle_tlb_refill, 0x80);
+#endif
         local_flush_icache_range(tlbrentry, tlbrentry + 0x80);
 
         for (int i = EXCCODE_TLBL; i <= EXCCODE_TLBPE; i++)
@@ -167,6 +248,27 @@ void tlb_init(void)
     setup_tlb_handler();
 }
 
+/**
+ * @brief 读取指定核的TLB重填次数
+ *
+ * @details 仅在以CONFIG_TLB_REFILL_STAT构建并安装剖析版重填
+ *          处理时计数递增，否则恒为0；启用硬件PTW的机型重填
+ *          不进入软件路径，计数同样保持为0
+ *
+ * @param cpu CPU编号
+ *
+ * @return 该核自启动以来的软件TLB重填次数，编号非法返回0
+ */
+u64 tlb_refill_count_get(u32 cpu)
+{
+    if (cpu >= (u32)CONFIG_MAX_CPUS)
+    {
+        return 0U;
+    }
+
+    return tlb_refill_count[cpu][0];
+}
+
 /**
  * @brief 显示TLB信息
  *
@@ -294,6 +396,12 @@ void __attribute__((__section__(".kprobes.text"))) do_page_fault(struct arch_con
                                                                  unsigned long write,
                                                                  unsigned long address)
 {
+    /* 内核态访问用户空间出错：查异常修复表，命中则回填后继续执行 */
+    if (fixup_exception(regs))
+    {
+        return;
+    }
+
     printk("page fault:bad address is %p write:[%d]\n\r", address, write);
     printk("CSR_ERA:[%p] \n\r", regs->csr_era);
     printk("CSR_BADV:[%p] \n\r", regs->csr_badvaddr);
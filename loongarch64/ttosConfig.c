@@ -57,6 +57,9 @@
 /* TTOS事件记录掩码 */
 #define TTOS_RECORD_MASK (TTOS_RECORD_TASK_SWITCH_MASK)
 
+/* 配置表与运行时控制块的缓存行对齐粒度（字节） */
+#define TTOS_CONFIG_CACHELINE 64U
+
 /*************************** 类型定义 ****************************/
 
 /*************************** 外部声明 ****************************/
@@ -64,22 +67,37 @@
 /*************************** 前向声明 ****************************/
 
 /*************************** 模块变量 ****************************/
-T_MODULE T_TTOS_TaskControlBlock tCB[CONFIG_TTOS_TASK_CONFIG_NUMBER];
+/*
+ * 布局约定：启动后只读的配置结构（*Config）彼此相邻聚集，
+ * 运行时会被写的控制块（*CB）各自缓存行对齐，避免控制块
+ * 的跨核写与只读配置数据共享同一缓存行产生伪共享
+ */
 T_MODULE T_TTOS_ConfigTimer timerConfig[CONFIG_TTOS_TIMER_CONFIG_NUMBER];
-T_MODULE T_TTOS_TimerControlBlock timerCB[CONFIG_TTOS_TIMER_CONFIG_NUMBER];
 T_MODULE T_TTOS_ConfigSema semaConfig[CONFIG_TTOS_SEMA_CONFIG_NUMBER];
 
 #ifdef TTOS_MSGQ
 T_MODULE T_TTOS_ConfigMsgq msgqConfig[CONFIG_TTOS_MSGQ_CONFIG_NUMBER];
 #endif
 
-T_MODULE T_TTOS_SemaControlBlock semaCB[CONFIG_TTOS_SEMA_CONFIG_NUMBER];
+T_MODULE T_TTOS_TaskControlBlock tCB[CONFIG_TTOS_TASK_CONFIG_NUMBER]
+    __attribute__((aligned(TTOS_CONFIG_CACHELINE)));
+T_MODULE T_TTOS_TimerControlBlock timerCB[CONFIG_TTOS_TIMER_CONFIG_NUMBER]
+    __attribute__((aligned(TTOS_CONFIG_CACHELINE)));
+T_MODULE T_TTOS_SemaControlBlock semaCB[CONFIG_TTOS_SEMA_CONFIG_NUMBER]
+    __attribute__((aligned(TTOS_CONFIG_CACHELINE)));
 
 #ifdef TTOS_MSGQ
-T_MODULE T_TTOS_MsgqControlBlock msgqCB[CONFIG_TTOS_MSGQ_CONFIG_NUMBER];
+T_MODULE T_TTOS_MsgqControlBlock msgqCB[CONFIG_TTOS_MSGQ_CONFIG_NUMBER]
+    __attribute__((aligned(TTOS_CONFIG_CACHELINE)));
 #endif
 
 /*************************** 全局变量 ****************************/
+/*
+ * 配置表被调度与中断路径频繁只读访问：整表缓存行对齐，
+ * 热读字段（各对象个数与控制结构指针）从行首开始聚集，
+ * 不与相邻可写数据共享缓存行
+ */
+__attribute__((aligned(TTOS_CONFIG_CACHELINE)))
 T_TTOS_ConfigTable ttosConfigTable =
 {
     /* 任务对象的配置结构指针 */
@@ -150,3 +168,9 @@ T_TTOS_ConfigTable ttosConfigTable =
      */
     TTOS_RECORD_MASK,
 };
+
+/* 布局回退保护：对齐属性被移除或缓存行粒度改变时编译期报错 */
+_Static_assert((TTOS_CONFIG_CACHELINE & (TTOS_CONFIG_CACHELINE - 1U)) == 0U,
+               "cacheline granularity must be power of two");
+_Static_assert(__alignof__(ttosConfigTable) >= TTOS_CONFIG_CACHELINE,
+               "ttosConfigTable must be cacheline aligned");
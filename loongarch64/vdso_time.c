@@ -0,0 +1,196 @@
+/**
+ * @file    vdso_time.c
+ * @brief   vDSO风格用户态快速取时实现（内核侧）
+ * @author  Intewell Team
+ * @date    2025-01-21
+ * @version 1.0
+ *
+ * @details 本文件维护内核与用户态共享的取时数据页
+ *          - 数据页为内核静态页，启动时按定时器频率填充
+ *            mult/shift定点系数和epoch基准
+ *          - 定时器中断在绑定核周期性刷新epoch，序列计数写协议
+ *            保证用户读侧不会看到半更新内容
+ *          - 进程创建时通过vdso_time_map以只读、用户可访问、
+ *            不可执行属性映射进用户地址空间
+ *
+ * @note MISRA-C:2012 合规
+ * @note 写路径为性能关键路径：仅一次序列计数往返和三次存储
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+/*************************** 头文件包含 ****************************/
+#include <barrier.h>
+#include <cpu-info.h>
+#include <cpu.h>
+#include <errno.h>
+#include <ktime-fast.h>
+#include <mmu.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <ttosMM.h>
+#include <ttos_time.h>
+#include <vdso-features.h>
+#include <vdso-time.h>
+
+/*************************** 宏定义 ****************************/
+
+/*************************** 数据结构 ****************************/
+/**
+ * @brief 共享数据页（整页，避免与其他内核数据同页）
+ *
+ * @details 页首为取时数据，VDSO_FEATURES_OFFSET处为CPU特性区，
+ *          二者共用一次只读映射
+ */
+union vdso_time_page
+{
+    struct
+    {
+        struct vdso_time_data time;                                       /**< @brief 取时数据 */
+        uint8_t reserved[VDSO_FEATURES_OFFSET - sizeof(struct vdso_time_data)]; /**< @brief 对齐填充 */
+        struct vdso_cpu_features features;                                /**< @brief CPU特性区 */
+    } data;                 /**< @brief 页内布局 */
+    uint8_t pad[PAGE_SIZE]; /**< @brief 填充到整页 */
+};
+
+/*************************** 模块变量 ****************************/
+/* 共享取时数据页：页对齐，内核可写，用户只读映射 */
+static union vdso_time_page s_vdso_page __attribute__((aligned(PAGE_SIZE)));
+
+/* 初始化完成标志：未初始化时定时器中断直接返回 */
+static volatile int s_vdso_inited;
+
+/*************************** 函数实现 ****************************/
+
+/**
+ * @brief 初始化共享取时数据页
+ *
+ * @details 按定时器频率填充mult/shift系数并建立epoch基准；
+ *          须在定时器频率初始化（g_ktime_fast_mult就绪）后调用
+ *
+ * @return 成功返回0，定时器系数未就绪返回-EAGAIN
+ */
+int vdso_time_init(void)
+{
+    struct vdso_time_data *vd = &s_vdso_page.data.time;
+
+    if (g_ktime_fast_mult == 0U)
+    {
+        return -EAGAIN;
+    }
+
+    vd->seq = 0U;
+    vd->mult = g_ktime_fast_mult;
+    vd->shift = g_ktime_fast_shift;
+    vd->freq = ttos_time_freq_get();
+    vd->epoch_count = drdtime();
+    vd->epoch_ns = (uint64_t)(((__uint128_t)vd->epoch_count * vd->mult) >> vd->shift);
+
+    /* 特性区与取时数据同页导出，cpu_probe此时已完成 */
+    vdso_features_init();
+
+    smp_wmb();
+    s_vdso_inited = 1;
+
+    return 0;
+}
+
+/**
+ * @brief 填充共享页特性区
+ *
+ * @details 从boot CPU的探测结果复制特性位图与平台参数，
+ *          启动时一次性写入，此后只读，用户侧无需同步协议
+ */
+void vdso_features_init(void)
+{
+    struct vdso_cpu_features *vf = &s_vdso_page.data.features;
+    const struct cpuinfo_loongarch *c = &boot_cpu_data;
+
+    vf->prid = c->processor_id;
+    vf->options = (uint64_t)c->options;
+    vf->isa_level = (int32_t)c->isa_level;
+    vf->vabits = (int32_t)c->vabits;
+    vf->pabits = (int32_t)c->pabits;
+    vf->fpu_vers = c->fpu_vers;
+    vf->cache_line = L1_CACHE_BYTES;
+    vf->page_size = PAGE_SIZE;
+    vf->timer_freq = ttos_time_freq_get();
+
+    /* 魔数最后写入，用户侧以其作为特性区就绪标志 */
+    smp_wmb();
+    vf->magic = VDSO_FEATURES_MAGIC;
+}
+
+/**
+ * @brief 刷新共享数据页epoch基准
+ *
+ * @details 定时器中断在绑定核调用，单写者；seq置奇→更新→置偶，
+ *          与用户读侧的序列计数读协议配对
+ *
+ * @note 性能关键路径：未初始化时单次分支返回
+ */
+void vdso_time_update(void)
+{
+    struct vdso_time_data *vd = &s_vdso_page.data.time;
+    uint64_t count;
+
+    if (s_vdso_inited == 0)
+    {
+        return;
+    }
+
+    count = drdtime();
+
+    vd->seq++;
+    smp_wmb();
+
+    vd->epoch_count = count;
+    vd->epoch_ns = (uint64_t)(((__uint128_t)count * vd->mult) >> vd->shift);
+
+    smp_wmb();
+    vd->seq++;
+}
+
+/**
+ * @brief 把共享取时数据页映射进用户地址空间
+ *
+ * @details 以只读、用户可访问、不可执行属性把数据页固定映射到
+ *          指定用户mm的目标虚拟地址
+ *
+ * @param mm 目标用户地址空间
+ * @param va 目标虚拟地址（页对齐）
+ *
+ * @return 成功返回0，参数无效返回-EINVAL，映射失败返回-ENOMEM
+ */
+int vdso_time_map(struct mm *mm, uintptr_t va)
+{
+    struct mm_region region;
+    phys_addr_t pa;
+
+    if ((mm == NULL) || ((va & (PAGE_SIZE - 1U)) != 0U))
+    {
+        return -EINVAL;
+    }
+
+    pa = kernel_v2p((virt_addr_t)&s_vdso_page);
+    if (pa == 0U)
+    {
+        return -EINVAL;
+    }
+
+    memset(&region, 0, sizeof(region));
+    region.virtual_address = (virt_addr_t)va;
+    region.physical_address = pa;
+    region.region_page_count = 1U;
+    region.map_min = (virt_addr_t)va;
+    region.flags = MAP_FIXED;
+    /* 只读（无MT_RW）、用户可访问、不可执行 */
+    region.mem_attr = MT_MEMORY | MT_USER | MT_EXECUTE_NEVER;
+
+    if (arch_get_mmu_ops()->map(mm, &region) != 0)
+    {
+        return -ENOMEM;
+    }
+
+    return 0;
+}
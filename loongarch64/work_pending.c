@@ -0,0 +1,41 @@
+/**
+ * @file    work_pending.c
+ * @brief   返回用户态前待处理工作标志实现
+ * @author  Intewell Team
+ * @date    2025-08-29
+ * @version 1.0
+ *
+ * @details 本文件定义每核缓存行对齐的待处理工作标志实体
+ *          - 信号入队方与调度器置位，返回用户态路径判零
+ *            后按需进入信号检查C层
+ *          - 快速退出经显式开关启用，未启用时各返回路径
+ *            行为与原实现一致
+ *
+ * @note MISRA-C:2012 合规
+ *
+ * @copyright Copyright (c) 2025 Intewell Team
+ */
+
+/*************************** 头文件包含 ****************************/
+#include <work-pending.h>
+
+/*************************** 模块变量 ****************************/
+/* 每核待处理工作标志（独占缓存行） */
+DEFINE_PER_CPU(struct arch_work_flags, arch_work_pending);
+
+/* 快速退出开关：入队路径全部接通置位调用后开启 */
+volatile int g_arch_work_fast_exit;
+
+/*************************** 函数实现 ****************************/
+
+/**
+ * @brief 开启返回用户态快速退出
+ *
+ * @details 开启后arch_work_pending_test按标志字判零，
+ *          标志为零的返回路径不再进入信号检查C层；
+ *          须在所有信号入队/调度请求路径接通置位调用后开启
+ */
+void arch_work_fast_exit_enable(void)
+{
+    g_arch_work_fast_exit = 1;
+}